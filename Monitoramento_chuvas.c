@@ -1,542 +1,1388 @@
-/**
- * Sistema de Monitoramento de Chuva e Nvel de gua
- * 
- * Hardware:
- * - Raspberry Pi Pico
- * - Display OLED SSD1306 via I2C
- * - Joystick analgico (eixos X e Y)
- * - Matriz de LEDs
- * - Buzzer
- * - LEDs PWM (vermelho e verde)
- */
-
-#include "pico/stdlib.h"
-#include "hardware/gpio.h"
-#include "hardware/adc.h"
-#include "hardware/i2c.h"
-#include "lib/ssd1306.h"
-#include "lib/font.h"
-#include "hardware/pwm.h"
-#include "FreeRTOS.h"
-#include "task.h"
-#include "queue.h"
-#include <stdio.h>
-#include "hardware/pio.h"
-#include "math.h"
-#include "hardware/clocks.h"
-#include "animacoes_led.pio.h" // Animaes LEDs PIO
-#include "pico/bootrom.h"
-
-// ================= CONFIGURAES DE HARDWARE =================
-#define I2C_PORT i2c1
-#define I2C_SDA 14
-#define I2C_SCL 15
-#define endereco 0x3C
-#define ADC_JOYSTICK_X 26  // Pino ADC para eixo X (volume de chuva)
-#define ADC_JOYSTICK_Y 27  // Pino ADC para eixo Y (nvel de gua)
-#define LED_MATRIX_PIN 7   // Pino da matriz de LEDs
-#define NUM_PIXELS 25      // Nmero de LEDs na matriz
-#define LED_RED 13         // LED vermelho
-#define LED_GREEN 11       // LED verde
-#define BUZZER_PIN 21      // Pino do buzzer
-#define BUTTON_B 6         // Boto para modo BOOTSEL
-
-// ================= VARIVEIS GLOBAIS =================
-PIO pio;                   // Controlador PIO para matriz de LEDs
-uint sm;                   // State Machine do PIO
-int current_pattern;       // Padro atual da matriz de LEDs
-
-// ================= ESTRUTURAS DE DADOS =================
-typedef enum {
-    COR_VERMELHO,
-    COR_VERDE,
-    COR_AZUL,
-    COR_AMARELO,
-    COR_BRANCO
-} CorLED;
-
-typedef struct {
-    uint16_t x_volume_chuva;  // Valor do eixo X (volume de chuva)
-    uint16_t y_nivel_agua;    // Valor do eixo Y (nvel de gua)
-} Dados_analogicos;
-
-QueueHandle_t xQueueJoystickData;  // Fila para compartilhamento de dados entre tasks
-
-// ================= DEFINIES DE PADRES =================
-// Matriz com representaes dos padres para a matriz de LEDs (5x5)
-double padroes_led[4][25] = {
-    // Padro 0
-    {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-    // Padro 1
-    {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0},
-    // Padro 2
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0},
-    // Todos LEDs apagados
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-};
-
-// ================= FUNES DE CONTROLE DE LEDS =================
-
-/**
- * Converte valores RGBW em um valor de cor para a matriz de LEDs
- */
-uint32_t matrix_rgb(double r, double g, double b, double w) {
-    uint8_t red = (uint8_t)(r * 255);
-    uint8_t green = (uint8_t)(g * 255);
-    uint8_t blue = (uint8_t)(b * 255);
-    uint8_t white = (uint8_t)(w * 255);
-    return (red << 24) | (green << 16) | (blue << 8) | white;
-}
-
-/**
- * Atualiza a matriz de LEDs com o padro atual e cor especificada
- */
-void Desenho_matriz_leds(double r, double g, double b, double w) {
-    for (int i = 0; i < NUM_PIXELS; i++) {
-        double valor = padroes_led[current_pattern][i];
-        uint32_t cor_led = (valor > 0) ? matrix_rgb(r, g, b, w) : matrix_rgb(0, 0, 0, 0);
-        pio_sm_put_blocking(pio, sm, cor_led);
-    }
-}
-
-/**
- * Atualiza a matriz de LEDs com uma cor pr-definida
- */
-void Desenho_matriz_leds_cor(CorLED cor) {
-    double r = 0, g = 0, b = 0, w = 0;
-    switch (cor) {
-        case COR_VERMELHO: r = 1.0; break;
-        case COR_VERDE: g = 1.0; break;
-        case COR_AZUL: b = 1.0; break;
-        case COR_AMARELO: r = 1.0; g = 1.0; break;
-        case COR_BRANCO: w = 1.0; break;
-    }
-    Desenho_matriz_leds(r, g, b, w);
-}
-
-// ================= FUNES DE CONFIGURAO DE HARDWARE =================
-
-/**
- * Configura um pino para sada PWM
- */
-void config_PWM(uint led_pin, float clk_div, uint wrap) {
-    gpio_set_function(led_pin, GPIO_FUNC_PWM);
-    uint slice = pwm_gpio_to_slice_num(led_pin);
-    uint channel = pwm_gpio_to_channel(led_pin);
-
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, clk_div);
-    pwm_config_set_wrap(&config, wrap);
-
-    pwm_init(slice, &config, true);
-    pwm_set_chan_level(slice, channel, 0);
-}
-
-/**
- * Toca um som no buzzer com frequncia e durao especificadas
- */
-void buzzer_tocar(uint buzzer_pin, uint freq_hz, uint duracao_ms) {
-    float clk_div = 125.0f;
-    uint wrap = 125000000 / (clk_div * freq_hz);
-    
-    config_PWM(buzzer_pin, clk_div, wrap);
-
-    uint slice = pwm_gpio_to_slice_num(buzzer_pin);
-    uint channel = pwm_gpio_to_channel(buzzer_pin);
-
-    pwm_set_chan_level(slice, channel, wrap / 2);
-    vTaskDelay(pdMS_TO_TICKS(duracao_ms));
-    pwm_set_chan_level(slice, channel, 0);
-}
-
-/**
- * Toca um som de estado de ateno
- */
-void Som_estado_atencao() {
-    for (int i = 0; i < 3; i++) {
-        buzzer_tocar(BUZZER_PIN, 100, 200);  // tom grave
-        buzzer_tocar(BUZZER_PIN, 200, 200);  // tom mdio
-        buzzer_tocar(BUZZER_PIN, 300, 200);  // tom mais agudo
-    }
-}
-
-/**
- * Toca um som de estado de alerta
- */
-void Som_estado_alerta() {
-    for (int i = 0; i < 8; i++) {
-        buzzer_tocar(BUZZER_PIN, 2500, 80);  // som rpido e agudo
-        vTaskDelay(pdMS_TO_TICKS(50));       // intervalo curto
-    }
-}
-
-// ================= TASKS DO FreeRTOS =================
-
-/**
- * Task para leitura dos valores do joystick (ADC)
- */
-void vJoystickTask(void *params) {
-    // Inicializao do ADC
-    adc_gpio_init(ADC_JOYSTICK_Y);
-    adc_gpio_init(ADC_JOYSTICK_X);
-    adc_init();
-
-    Dados_analogicos Dados;
-
-    while (true) {
-        // Leitura do eixo Y (nvel de gua)
-        adc_select_input(0); // GPIO 26 = ADC0
-        Dados.y_nivel_agua = adc_read();
-
-        // Leitura do eixo X (volume de chuva)
-        adc_select_input(1); // GPIO 27 = ADC1
-        Dados.x_volume_chuva = adc_read();
-
-        // Envia os dados para a fila
-        xQueueSend(xQueueJoystickData, &Dados, 0);
-        vTaskDelay(pdMS_TO_TICKS(100)); // 10 Hz de leitura
-    }
-}
-
-/**
- * Exibe um alerta no display OLED
- */
-void ExibirAlerta(ssd1306_t *ssd, const char *titulo, const char *linha1, const char *linha2) {
-    bool cor = true; // true = branco, false = preto
-    
-    ssd1306_fill(ssd, !cor);
-    ssd1306_draw_string(ssd, titulo, 40, linha2 ? 10 : 20);
-    ssd1306_draw_string(ssd, linha1, 15, linha2 ? 20 : 30);
-    
-    if (linha2 != NULL) {
-        ssd1306_draw_string(ssd, linha2, 15, 50);
-    }
-    
-    ssd1306_send_data(ssd);
-    sleep_ms(1000);
-}
-
-/**
- * Tarefa para exibio no display OLED
- */
-void vDisplayTask(void *params)
-{
-    // Inicializao do hardware I2C e display
-    i2c_init(I2C_PORT, 400 * 1000);
-    gpio_set_function(I2C_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA);
-    gpio_pull_up(I2C_SCL);
-
-    // Configurao inicial do display OLED
-    ssd1306_t ssd;
-    ssd1306_init(&ssd, WIDTH, HEIGHT, false, endereco, I2C_PORT);
-    ssd1306_config(&ssd);
-    ssd1306_send_data(&ssd);
-
-    Dados_analogicos Dados; // Dados recebidos do joystick
-    bool cor = true; // true = branco (desenhar), false = preto (limpar)
-    
-    while (true)
-    {
-        // Aguarda novos dados da fila (bloqueante)
-        if (xQueueReceive(xQueueJoystickData, &Dados, portMAX_DELAY) == pdTRUE)
-        {
-            /* ========== CONFIGURAO DAS BARRAS DE PROGRESSO ========== */
-            // Inicializa todos os segmentos como no preenchidos (true)
-            bool cor_ch_100 = true; bool cor_ch_90 = true; bool cor_ch_80 = true; 
-            bool cor_ch_70 = true; bool cor_ch_60 = true; bool cor_ch_50 = true; 
-            bool cor_ch_40 = true; bool cor_ch_30 = true; bool cor_ch_20 = true; 
-            bool cor_ch_10 = true;
-
-            bool cor_ni_100 = true; bool cor_ni_90 = true; bool cor_ni_80 = true; 
-            bool cor_ni_70 = true; bool cor_ni_60 = true; bool cor_ni_50 = true; 
-            bool cor_ni_40 = true; bool cor_ni_30 = true; bool cor_ni_20 = true; 
-            bool cor_ni_10 = true;
-
-            // Valores para aproximar a porcentagem
-            const float Percentual[] = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
-
-            // Converte valores ADC para porcentagem (0-100)
-            float x = (Dados.x_volume_chuva * 100) / 4088; // Chuva (eixo X)
-            float y = (Dados.y_nivel_agua * 100) / 4088;   // Nvel gua (eixo Y)
-
-            /* ========== CLCULO DO PERCENTUAL MAIS PRXIMO ========== */
-            float valor_real_chuva = x;
-            float valor_real_nivel = y;
-            float erro_novo_chuva = 100000;
-            float erro_novo_nivel = 100000;
-            uint16_t Percentual_chuva, Percentual_nivel;
-   
-            // Encontra valor mais prximo da porcentagem para chuva
-            for (int k = 0; k < 11; k++) {
-                float erro_chuva = fabs(valor_real_chuva - Percentual[k]);
-                if (erro_chuva < erro_novo_chuva) {
-                    erro_novo_chuva = erro_chuva;
-                    Percentual_chuva = Percentual[k];
-                }
-            }
-
-            // Encontra valor mais prximo de porcentagem para nvel
-            for (int m = 0; m < 11; m++) {
-                float erro_nivel = fabs(valor_real_nivel - Percentual[m]);
-                if (erro_nivel < erro_novo_nivel) {
-                    erro_novo_nivel = erro_nivel;
-                    Percentual_nivel = Percentual[m];
-                }
-            }
-
-            /* ========== PREPARAO DOS VALORES PARA EXIBIO ========== */
-            char str_chuva[10], str_nivel[10];
-            sprintf(str_chuva, "%1.0f", x); // Formata valor da chuva sem decimais
-            sprintf(str_nivel, "%1.0f", y); // Formata valor do nvel sem decimais
-
-            /* ========== ATUALIZA ESTADO DOS SEGMENTOS DA CHUVA ========== */
-            switch (Percentual_chuva) {
-                case 10: cor_ch_10 = false; break;
-                case 20: cor_ch_10 = false; cor_ch_20 = false; break;
-                case 30: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; break;
-                case 40: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; break;
-                case 50: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; break;
-                case 60: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; cor_ch_60 = false; break;
-                case 70: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; cor_ch_60 = false; cor_ch_70 = false; break;
-                case 80: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; cor_ch_60 = false; cor_ch_70 = false; cor_ch_80 = false; break;
-                case 90: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; cor_ch_60 = false; cor_ch_70 = false; cor_ch_80 = false; cor_ch_90 = false; break;
-                case 100: cor_ch_10 = false; cor_ch_20 = false; cor_ch_30 = false; cor_ch_40 = false; cor_ch_50 = false; cor_ch_60 = false; cor_ch_70 = false; cor_ch_80 = false; cor_ch_90 = false; cor_ch_100 = false; break;
-                default: break;
-            }
-
-            /* ========== ATUALIZA ESTADO DOS SEGMENTOS DO NVEL ========== */
-            switch (Percentual_nivel) {
-                case 10: cor_ni_10 = false; break;
-                case 20: cor_ni_10 = false; cor_ni_20 = false; break;
-                case 30: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; break;
-                case 40: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; break;
-                case 50: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; break;
-                case 60: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; cor_ni_60 = false; break;
-                case 70: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; cor_ni_60 = false; cor_ni_70 = false; break;
-                case 80: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; cor_ni_60 = false; cor_ni_70 = false; cor_ni_80 = false; break;
-                case 90: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; cor_ni_60 = false; cor_ni_70 = false; cor_ni_80 = false; cor_ni_90 = false; break;
-                case 100: cor_ni_10 = false; cor_ni_20 = false; cor_ni_30 = false; cor_ni_40 = false; cor_ni_50 = false; cor_ni_60 = false; cor_ni_70 = false; cor_ni_80 = false; cor_ni_90 = false; cor_ni_100 = false; break;
-                default: break;
-            }
-
-            /* ========== ATUALIZAO DO DISPLAY ========== */
-            ssd1306_fill(&ssd, !cor); // Limpa a tela
-
-            // Exibe ttulo e valor da chuva
-            ssd1306_draw_string(&ssd, "CHUVA", 0, 3);
-            ssd1306_draw_string(&ssd, str_chuva, 40, 3);
-
-            // Desenha todos os segmentos da barra de chuva (10 segmentos)
-            ssd1306_rect(&ssd, 14, 10, 30, 5, cor, !cor_ch_100);
-            ssd1306_rect(&ssd, 19, 10, 30, 5, cor, !cor_ch_90);
-            ssd1306_rect(&ssd, 24, 10, 30, 5, cor, !cor_ch_80);
-            ssd1306_rect(&ssd, 29, 10, 30, 5, cor, !cor_ch_70);
-            ssd1306_rect(&ssd, 34, 10, 30, 5, cor, !cor_ch_60);
-            ssd1306_rect(&ssd, 39, 10, 30, 5, cor, !cor_ch_50);
-            ssd1306_rect(&ssd, 44, 10, 30, 5, cor, !cor_ch_40);
-            ssd1306_rect(&ssd, 49, 10, 30, 5, cor, !cor_ch_30);
-            ssd1306_rect(&ssd, 54, 10, 30, 5, cor, !cor_ch_20);
-            ssd1306_rect(&ssd, 59, 10, 30, 5, cor, !cor_ch_10);
-            
-            // Exibe ttulo e valor do nvel
-            ssd1306_draw_string(&ssd, "NIVEL", 64, 3);
-            ssd1306_draw_string(&ssd, str_nivel, 102, 3);
-
-            // Desenha todos os segmentos da barra de nvel (10 segmentos)
-            ssd1306_rect(&ssd, 14, 75, 30, 5, cor, !cor_ni_100);
-            ssd1306_rect(&ssd, 19, 75, 30, 5, cor, !cor_ni_90);
-            ssd1306_rect(&ssd, 24, 75, 30, 5, cor, !cor_ni_80);
-            ssd1306_rect(&ssd, 29, 75, 30, 5, cor, !cor_ni_70);
-            ssd1306_rect(&ssd, 34, 75, 30, 5, cor, !cor_ni_60);
-            ssd1306_rect(&ssd, 39, 75, 30, 5, cor, !cor_ni_50);
-            ssd1306_rect(&ssd, 44, 75, 30, 5, cor, !cor_ni_40);
-            ssd1306_rect(&ssd, 49, 75, 30, 5, cor, !cor_ni_30);
-            ssd1306_rect(&ssd, 54, 75, 30, 5, cor, !cor_ni_20);
-            ssd1306_rect(&ssd, 59, 75, 30, 5, cor, !cor_ni_10);
-            
-            ssd1306_send_data(&ssd); // Envia buffer para o display
-
-            /* ========== TRATAMENTO DE ALERTAS ========== */
-            // Alerta para chuva intensa E nvel elevado
-            if ((y >= 70) && (x >= 80)) {
-                sleep_ms(1000);
-                ssd1306_fill(&ssd, !cor);
-                
-                // Mensagens de alerta duplo
-                ssd1306_draw_string(&ssd, "ALERTA", 40, 10);
-                ssd1306_draw_string(&ssd, "CHUVA INTENSA", 15, 20);
-                ssd1306_draw_string(&ssd, "ALERTA", 40, 40);
-                ssd1306_draw_string(&ssd, "NIVEL ELEVADO", 15, 50);
-                
-                ssd1306_send_data(&ssd);
-                sleep_ms(1000);
-            } 
-            // Alerta apenas para nvel elevado
-            else if ((y >= 70) && (x < 80)) {
-                sleep_ms(1000);
-                ssd1306_fill(&ssd, !cor);
-                
-                // Mensagem de alerta nico
-                ssd1306_draw_string(&ssd, "ALERTA", 40, 20);
-                ssd1306_draw_string(&ssd, "NIVEL ELEVADO", 15, 30);
-                
-                ssd1306_send_data(&ssd);
-                sleep_ms(1000);
-            } 
-            // Alerta apenas para chuva intensa
-            else if ((y < 70) && (x >= 80)) {
-                sleep_ms(1000);
-                ssd1306_fill(&ssd, !cor);
-                
-                // Mensagem de alerta nico
-                ssd1306_draw_string(&ssd, "ALERTA", 40, 20);
-                ssd1306_draw_string(&ssd, "CHUVA INTENSA", 15, 30);
-                
-                ssd1306_send_data(&ssd);
-                sleep_ms(1000);
-            }
-        }
-    }
-}
-
-/**
- * Task para controle dos LEDs PWM
- */
-void vControle_leds(void *params) {
-    Dados_analogicos Dados;
-    
-    while (true) {
-        if (xQueueReceive(xQueueJoystickData, &Dados, portMAX_DELAY) == pdTRUE) {
-            uint slice_red = pwm_gpio_to_slice_num(LED_RED);
-            uint channel_red = pwm_gpio_to_channel(LED_RED);
-            uint slice_green = pwm_gpio_to_slice_num(LED_GREEN);
-            uint channel_green = pwm_gpio_to_channel(LED_GREEN);
-
-            // Controle dos LEDs baseado nos valores lidos
-            if (Dados.x_volume_chuva > 3271 || Dados.y_nivel_agua > 2862) {
-                // Estado de alerta - LED vermelho aceso
-                pwm_set_chan_level(slice_green, channel_green, 0);
-                pwm_set_chan_level(slice_red, channel_red, 100);
-            } else if ((Dados.x_volume_chuva > 1635 && Dados.x_volume_chuva < 3271) || 
-                      (Dados.y_nivel_agua > 1635 && Dados.y_nivel_agua < 2862)) {
-                // Estado de ateno - ambos LEDs acesos
-                pwm_set_chan_level(slice_green, channel_green, 100);
-                pwm_set_chan_level(slice_red, channel_red, 100);
-            } else {
-                // Estado normal - LED verde aceso
-                pwm_set_chan_level(slice_green, channel_green, 100);
-                pwm_set_chan_level(slice_red, channel_red, 0);
-            }
-
-            vTaskDelay(pdMS_TO_TICKS(50));
-        }
-    }
-}
-
-/**
- * Task para controle da matriz de LEDs
- */
-void vControle_matriz_leds(void *params) {
-    // Inicializao PIO para matriz de LEDs
-    pio = pio0;
-    uint offset = pio_add_program(pio, &animacoes_led_program);
-    sm = pio_claim_unused_sm(pio, true);
-    animacoes_led_program_init(pio, sm, offset, LED_MATRIX_PIN);
-
-    Dados_analogicos Dados;
-
-    while (true) {
-        if (xQueueReceive(xQueueJoystickData, &Dados, portMAX_DELAY) == pdTRUE) {
-            if (Dados.x_volume_chuva > 3271 || Dados.y_nivel_agua > 2862) {
-                // Animao de alerta
-                current_pattern = 0;
-                Desenho_matriz_leds_cor(COR_VERMELHO);
-                sleep_ms(500);
-
-                current_pattern = 1;
-                Desenho_matriz_leds_cor(COR_VERDE);
-                sleep_ms(500);
-
-                current_pattern = 2;
-                Desenho_matriz_leds_cor(COR_AZUL);
-                sleep_ms(500);
-            } else {
-                // Estado normal - LEDs apagados
-                current_pattern = 3;
-                Desenho_matriz_leds(0.0, 0.0, 0.0, 0.0);
-                sleep_ms(1000);
-            }
-
-            vTaskDelay(pdMS_TO_TICKS(50));
-        }
-    }
-}
-
-/**
- * Task para controle do buzzer
- */
-void vControle_buzzer(void *params) {
-    Dados_analogicos Dados;
-
-    while (true) {
-        if (xQueueReceive(xQueueJoystickData, &Dados, portMAX_DELAY) == pdTRUE) {
-            if (Dados.x_volume_chuva > 3271 || Dados.y_nivel_agua > 2862) {
-                Som_estado_alerta();
-            } else if ((Dados.x_volume_chuva > 1635 && Dados.x_volume_chuva < 3271) || 
-                      (Dados.y_nivel_agua > 1635 && Dados.y_nivel_agua < 2862)) {
-                Som_estado_atencao();
-            } else {
-                gpio_put(BUZZER_PIN, 0);
-                sleep_ms(100);
-            }
-
-            sleep_ms(50);
-        }
-    }
-}
-
-/**
- * Handler para interrupo do boto BOOTSEL
- */
-void gpio_irq_handler(uint gpio, uint32_t events) {
-    reset_usb_boot(0, 0);
-}
-
-// ================= FUNO PRINCIPAL =================
-int main() {
-    // Configurao do boto BOOTSEL
-    gpio_init(BUTTON_B);
-    gpio_set_dir(BUTTON_B, GPIO_IN);
-    gpio_pull_up(BUTTON_B);
-    gpio_set_irq_enabled_with_callback(BUTTON_B, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
-
-    // Configurao dos LEDs
-    gpio_init(LED_RED);
-    gpio_init(LED_GREEN);
-    config_PWM(LED_GREEN, 4.0f, 100);
-    config_PWM(LED_RED, 4.0f, 100);
-
-    // Configurao do buzzer
-    gpio_init(BUZZER_PIN);
-    gpio_set_dir(BUZZER_PIN, GPIO_OUT);
-
-    // Inicializao da comunicao serial
-    stdio_init_all();
-    sleep_ms(2000);
-
-    // Criao da fila para compartilhamento de dados
-    xQueueJoystickData = xQueueCreate(5, sizeof(Dados_analogicos));
-
-    // Criao das tasks do FreeRTOS
-    xTaskCreate(vJoystickTask, "Joystick Task", 256, NULL, 1, NULL);
-    xTaskCreate(vDisplayTask, "Display Task", 512, NULL, 1, NULL);
-    xTaskCreate(vControle_leds, "LED red Task", 256, NULL, 1, NULL);
-    xTaskCreate(vControle_matriz_leds, "Matriz_leds Task", 256, NULL, 1, NULL);
-    xTaskCreate(vControle_buzzer, "Buzzer Task", 256, NULL, 1, NULL);
-
-    // Inicia o agendador do FreeRTOS
-    vTaskStartScheduler();
-    panic_unsupported();
-}
\ No newline at end of file
+/**
+ * Sistema de Monitoramento de Chuva e Nível de Água
+ * 
+ * Hardware:
+ * - Raspberry Pi Pico
+ * - Display OLED SSD1306 via I2C
+ * - Joystick analógico (eixos X e Y)
+ * - Matriz de LEDs
+ * - Buzzer
+ * - LEDs PWM (vermelho e verde)
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/adc.h"
+#include "hardware/i2c.h"
+#include "lib/ssd1306.h"
+#include "lib/font.h"
+#include "lib/canais.h"
+#include "lib/telemetria.h"
+#include "lib/painel.h"
+#include "lib/cores.h"
+#include "lib/boot.h"
+#include "lib/entrega.h"
+#include "lib/carga.h"
+#include "lib/barramento.h"
+#include "lib/historico.h"
+#include "lib/filtro.h"
+#include "lib/config.h"
+#include "lib/saude.h"
+#include "lib/ram.h"
+#include "lib/perfil_xip.h"
+#include "lib/relogio.h"
+#include "hardware/pwm.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include <stdio.h>
+#include <string.h>
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "math.h"
+#include "hardware/clocks.h"
+#include "animacoes_led.pio.h" // Animações LEDs PIO
+#include "pico/bootrom.h"
+#include "pico/stdio_usb.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "hardware/watchdog.h"
+#include "tusb.h"
+
+// ================= CONFIGURAÇÕES DE HARDWARE =================
+#define I2C_PORT i2c1
+#define I2C_SDA 14
+#define I2C_SCL 15
+#define endereco 0x3C
+#define I2C_BARRAMENTO_HZ 1000000 // Fast-mode Plus; a 1 MHz o barramento precisa de pull-ups externos fortes
+#define DISPLAY_I2C_HZ 400000      // SSD1306: 400 kHz pela folha de dados (muitos módulos aceitam 1 MHz)
+#define HABILITAR_SENSORES_I2C 0   // 1 = cadastra pluviômetro e sensor de pressão no barramento
+#define PLUVIOMETRO_ENDERECO 0x30  // Contador de pulsos do pluviômetro
+#define PLUVIOMETRO_REGISTRADOR 0x00
+#define PRESSAO_ENDERECO 0x28      // Sensor de pressão (nível), leitura direta de 2 bytes
+#define SENSORES_I2C_HZ 1000000
+#define ADC_JOYSTICK_X 26  // Pino ADC para eixo X (volume de chuva)
+#define ADC_JOYSTICK_Y 27  // Pino ADC para eixo Y (nível de água)
+#define HABILITAR_CANAL_ADC2 0 // 1 = cadastra o medidor ligado ao ADC2 (GPIO 28)
+#define FILTRO_MODO FILTRO_HAMPEL // Rejeição de picos (ex.: motor da bomba) antes dos limiares
+#define FILTRO_PASSO_MAX 0     // Variação máxima por amostra em contagens brutas; 0 = sem limite
+#define LED_MATRIX_PIN 7   // Pino da matriz de LEDs
+#define NUM_PIXELS 25      // Número de LEDs na matriz
+#define MATRIZ_BRILHO 64   // Brilho global da matriz (0-255), proporcional à corrente
+#define LED_RED 13         // LED vermelho
+#define LED_GREEN 11       // LED verde
+#define LED_PWM_WRAP 100   // Níveis de brilho dos LEDs PWM
+#define LED_PWM_HZ 300000  // Frequência do PWM dos LEDs, mantida em qualquer clk_sys
+#define BUZZER_PIN 21      // Pino do buzzer
+#define BUZZER_CONTADOR_HZ 1000000 // Contador do PWM do buzzer: 1 us por passo
+#define BUTTON_B 6         // Botão para modo BOOTSEL
+#define TELEM_CONTADORES_MS 1000 // Período do quadro de contadores da telemetria
+#define CONFIG_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE) // Último setor guarda a configuração
+#define CONFIG_MAGICA 0x31474643 // "CFG1"
+#define CONFIG_QUADRO_MAX (CONFIG_ITENS_MAX + 4) // Comando em COBS: itens + CRC + sobrecarga
+#define AMOSTRAGEM_HZ 10         // Taxa normal de aquisição dos canais
+#define AMOSTRAGEM_TICK_MIN_US 1000 // Acima de 1 kHz o timer dispara a cada 1 ms com várias amostras
+
+// Modo de estresse: carga sintética e busca da maior taxa de amostragem sem perdas
+#ifndef MODO_ESTRESSE
+#define MODO_ESTRESSE 0
+#endif
+#define ESTRESSE_PASSO_MS 2000   // Duração de cada taxa testada
+
+// Frequência do clk_sys pelo estado de alerta (lib/relogio.h); no modo de estresse fica fixa
+#ifndef ESCALA_RELOGIO
+#define ESCALA_RELOGIO 0
+#endif
+#define RELOGIO_VERIFICAR_MS 1000 // Contabiliza e reavalia a descida mesmo sem amostras novas
+
+// Prioridades: aquisição e alerta entram no ar antes do display e da USB
+#define PRIORIDADE_AQUISICAO 3
+#define PRIORIDADE_ALERTA 2
+#define PRIORIDADE_RELOGIO PRIORIDADE_ALERTA // Sobe o relógio junto com o alerta
+#define PRIORIDADE_DISPLAY 1
+#define PRIORIDADE_TELEMETRIA tskIDLE_PRIORITY
+#define PRIORIDADE_ESTRESSE (PRIORIDADE_AQUISICAO + 1) // Só mede; dorme quase sempre
+#define PRIORIDADE_I2C (PRIORIDADE_AQUISICAO + 1)      // Serve os clientes sem inversão; dorme durante as transferências
+
+// Pilhas em palavras de 4 bytes: o dobro do pior caso estimado da cadeia de
+// chamadas mais funda (quadros do -fstack-usage, mais SDK, newlib e troca de
+// contexto), arredondado para 128 palavras. Com configCHECK_FOR_STACK_OVERFLOW
+// um estouro reinicia a estação; conferir com os registros TELEM_PILHA.
+#define PILHA_I2C 384          // ~480 B: recuperação do barramento (i2c_init)
+#define PILHA_AQUISICAO 384    // ~610 B: histórico fechando em cascata, leitura I2C
+#define PILHA_ALERTA 256       // ~420 B: LEDs, buzzer e matriz
+#define PILHA_DISPLAY 512      // ~820 B: título do gráfico com snprintf
+#define PILHA_TELEMETRIA 512   // ~950 B: fwrite pela USB, comando de configuração e gravação da flash
+#define PILHA_RELOGIO 256      // ~400 B: reprogramação dos PLLs
+#define PILHA_ESTRESSE 256     // ~350 B
+
+// ================= VARIÁVEIS GLOBAIS =================
+PIO pio;                   // Controlador PIO para matriz de LEDs
+uint sm;                   // State Machine do PIO
+int current_pattern;       // Padrão atual da matriz de LEDs
+uint dma_matriz;           // Canal DMA que alimenta o PIO da matriz
+volatile bool matriz_pronta; // PIO e DMA da matriz iniciados pela task
+volatile bool matriz_pausada; // Troca de relógio em andamento: nenhum quadro novo
+uint32_t quadro_matriz[NUM_PIXELS]; // Quadro empacotado (GRB) lido pelo DMA
+
+// ================= ESTRUTURAS DE DADOS =================
+typedef enum {
+    COR_VERMELHO,
+    COR_VERDE,
+    COR_AZUL,
+    COR_AMARELO,
+    COR_BRANCO
+} CorLED;
+
+const Cor_rgb cores_led[] = {
+    [COR_VERMELHO] = {255, 0, 0},
+    [COR_VERDE] = {0, 255, 0},
+    [COR_AZUL] = {0, 0, 255},
+    [COR_AMARELO] = {255, 255, 0},
+    [COR_BRANCO] = {255, 255, 255}
+};
+
+Tabela_canais canais;              // Canais de medição da estação
+Entrega entrega_display;           // Amostra mais recente para o display
+Entrega entrega_leds;              // Amostra mais recente para os LEDs PWM
+Entrega entrega_matriz;            // Amostra mais recente para a matriz de LEDs
+Entrega entrega_buzzer;            // Amostra mais recente para o buzzer
+Anel_telemetria anel_telemetria;   // Registros aguardando envio pela USB
+Barramento_i2c barramento;         // I2C compartilhado entre display e sensores
+Cliente_i2c *cliente_display;
+Historico historico;               // Tendência dos primeiros canais (1 s / 1 min / 10 min)
+Filtro filtro;                     // Rejeição de picos entre a aquisição e os limiares
+Config_publicada config;           // Limiares, taxa e sons ajustáveis pela USB
+Saude saude;                       // Prazos e jitter das tasks periódicas
+Relogio relogio;                   // clk_sys por estado de alerta
+Entrega entrega_relogio;           // Amostra mais recente para a escala do relógio
+
+// Sensor no barramento I2C lido como canal FONTE_EXTERNA (entrada = índice)
+typedef struct {
+    Cliente_i2c *cliente;
+    int16_t registrador;   // -1: leitura direta, sem endereço de registrador
+    uint16_t mascara;      // Bits válidos (ex.: 0x3FFF descarta os bits de status)
+    uint16_t ultimo;       // Último valor válido, mantido se a leitura falhar
+} Sensor_i2c;
+
+Sensor_i2c sensores_i2c[2];
+
+// ================= DEFINIÇÕES DE PADRÕES =================
+// Matriz com representações dos padrões para a matriz de LEDs (5x5)
+uint8_t padroes_led[4][25] = {
+    // Padrão 0
+    {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+    // Padrão 1
+    {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0},
+    // Padrão 2
+    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0},
+    // Todos LEDs apagados
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+// ================= FUNÇÕES DE CONTROLE DE LEDS =================
+
+/**
+ * Atualiza a matriz de LEDs com o padrão atual e cor especificada
+ *
+ * Gama e brilho são aplicados uma vez por quadro (cores_palavra); o quadro
+ * empacotado vai para o PIO por DMA, sem a CPU tratar cada LED.
+ */
+void NA_RAM(Desenho_matriz_leds)(Cor_rgb cor) {
+    dma_channel_wait_for_finish_blocking(dma_matriz); // Quadro anterior já saiu
+    XIP_MEDIR(XIP_MATRIZ, cores_empacotar(padroes_led[current_pattern], cor, quadro_matriz, NUM_PIXELS));
+
+    // Teste e disparo juntos: Relogio_matriz só esvazia o que já começou
+    for (;;) {
+        taskENTER_CRITICAL();
+        if (!matriz_pausada) {
+            dma_channel_transfer_from_buffer_now(dma_matriz, quadro_matriz, NUM_PIXELS);
+            taskEXIT_CRITICAL();
+            return;
+        }
+        taskEXIT_CRITICAL();
+        vTaskDelay(1);
+    }
+}
+
+/**
+ * Atualiza a matriz de LEDs com uma cor pré-definida
+ */
+void Desenho_matriz_leds_cor(CorLED cor) {
+    Desenho_matriz_leds(cores_led[cor]);
+}
+
+// ================= FUNÇÕES DE CONFIGURAÇÃO DE HARDWARE =================
+
+/**
+ * Divisor do PWM para o contador avançar a contador_hz no clk_sys atual
+ */
+float Pwm_divisor(uint32_t contador_hz) {
+    return clock_get_hz(clk_sys) / (float)contador_hz;
+}
+
+/**
+ * Configura um pino para saída PWM
+ */
+void config_PWM(uint led_pin, float clk_div, uint wrap) {
+    gpio_set_function(led_pin, GPIO_FUNC_PWM);
+    uint slice = pwm_gpio_to_slice_num(led_pin);
+    uint channel = pwm_gpio_to_channel(led_pin);
+
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv(&config, clk_div);
+    pwm_config_set_wrap(&config, wrap);
+
+    pwm_init(slice, &config, true);
+    pwm_set_chan_level(slice, channel, 0);
+}
+
+/**
+ * Toca um som no buzzer com frequência e duração especificadas
+ */
+void buzzer_tocar(uint buzzer_pin, uint freq_hz, uint duracao_ms) {
+    uint wrap = BUZZER_CONTADOR_HZ / freq_hz;
+    uint slice = pwm_gpio_to_slice_num(buzzer_pin);
+    uint channel = pwm_gpio_to_channel(buzzer_pin);
+
+    // Divisor lido e escrito sem troca de relógio no meio (o ouvinte do PWM o corrige depois)
+    vTaskSuspendAll();
+    config_PWM(buzzer_pin, Pwm_divisor(BUZZER_CONTADOR_HZ), wrap);
+    pwm_set_chan_level(slice, channel, wrap / 2);
+    xTaskResumeAll();
+    vTaskDelay(pdMS_TO_TICKS(duracao_ms));
+    pwm_set_chan_level(slice, channel, 0);
+}
+
+/**
+ * Toca um padrão do buzzer: os tons em sequência e a pausa, repetidos
+ */
+void Tocar_padrao(const Padrao_buzzer *som) {
+    for (uint8_t i = 0; i < som->repeticoes; i++) {
+        for (uint8_t k = 0; k < som->tons; k++) {
+            buzzer_tocar(BUZZER_PIN, som->freq_hz[k], som->tom_ms);
+        }
+        if (som->pausa_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(som->pausa_ms));
+        }
+    }
+}
+
+/**
+ * Toca um som de estado de atenção (por padrão, escala grave-aguda)
+ */
+void Som_estado_atencao() {
+    // Cópia: o som dura mais que a carência da configuração
+    Padrao_buzzer som = config_atual(&config)->som_atencao;
+    Tocar_padrao(&som);
+}
+
+/**
+ * Toca um som de estado de alerta (por padrão, bipes rápidos e agudos)
+ */
+void Som_estado_alerta() {
+    Padrao_buzzer som = config_atual(&config)->som_alerta;
+    Tocar_padrao(&som);
+}
+
+// ================= SAÚDE DAS TASKS =================
+#define TAREFAS_MAX 12
+#define FALHA_MAGICA 0x4C484146 // "FALH"
+#define FALHA_NOME_MAX 16
+
+typedef enum {
+    FALHA_PILHA = 1,   // Estouro de pilha detectado pelo FreeRTOS
+    FALHA_HEAP = 2     // pvPortMalloc sem memória
+} TipoFalha;
+
+// Falha que causou o último reset; sobrevive ao reset por ficar fora da .bss
+typedef struct {
+    uint32_t magica;
+    uint32_t tipo;
+    char nome[FALHA_NOME_MAX];
+} Falha;
+
+Falha __uninitialized_ram(falha_registrada);
+Falha falha_anterior;                  // Cópia lida no boot, enviada pela telemetria
+
+TaskHandle_t tarefas[TAREFAS_MAX];     // Tasks com marca d'água de pilha reportada
+uint8_t n_tarefas;
+int saude_aquisicao;                   // Índices no monitor de prazos
+int saude_display;
+volatile bool estouro_pendente[SAUDE_TAREFAS_MAX]; // Cada um escrito só pela própria task
+
+/**
+ * Primeira task monitorada com estouro de prazo ainda não reportado, ou -1
+ */
+int Estouro_pendente() {
+    for (uint8_t t = 0; t < saude.n; t++) {
+        if (estouro_pendente[t]) {
+            return t;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Cria a task e guarda o handle para o relatório de pilha
+ */
+BaseType_t Criar_tarefa(TaskFunction_t funcao, const char *nome, uint32_t pilha, void *params,
+                        UBaseType_t prioridade, TaskHandle_t *handle) {
+    TaskHandle_t h = NULL;
+    BaseType_t ok = xTaskCreate(funcao, nome, pilha, params, prioridade, &h);
+    if (ok == pdPASS && n_tarefas < TAREFAS_MAX) {
+        tarefas[n_tarefas++] = h;
+    }
+    if (handle != NULL) {
+        *handle = h;
+    }
+    return ok;
+}
+
+/**
+ * Gancho do monitor: a telemetria envia o relatório da task na hora
+ */
+void Estouro_prazo(uint8_t tarefa, uint32_t resposta_us) {
+    estouro_pendente[tarefa] = true;
+}
+
+/**
+ * Guarda a falha fora da .bss e reinicia: a estação volta a medir e o
+ * host vê o motivo no primeiro relatório depois do boot
+ */
+void Registrar_falha(TipoFalha tipo, const char *nome) {
+    falha_registrada.tipo = tipo;
+    for (uint8_t i = 0; i < FALHA_NOME_MAX; i++) {
+        falha_registrada.nome[i] = nome[i];
+        if (nome[i] == '\0') {
+            break;
+        }
+    }
+    falha_registrada.nome[FALHA_NOME_MAX - 1] = '\0';
+    falha_registrada.magica = FALHA_MAGICA;
+    watchdog_reboot(0, 0, 0);
+    while (true) {
+        tight_loop_contents();
+    }
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t tarefa, char *nome) {
+    Registrar_falha(FALHA_PILHA, nome);
+}
+
+void vApplicationMallocFailedHook(void) {
+    bool agendador = xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+    Registrar_falha(FALHA_HEAP, agendador ? pcTaskGetName(NULL) : "main");
+}
+
+// ================= TASKS DO FreeRTOS =================
+
+/**
+ * Leitor dos canais ligados ao ADC interno
+ */
+uint16_t NA_RAM(ler_adc)(uint8_t entrada) {
+    adc_select_input(entrada);
+    return adc_read();
+}
+
+/**
+ * Leitor dos canais em sensores I2C (valor de 16 bits, mais significativo primeiro)
+ */
+uint16_t ler_i2c(uint8_t entrada) {
+    Sensor_i2c *s = &sensores_i2c[entrada];
+    uint8_t dados[2];
+    if (barramento_ler(s->cliente, s->registrador, dados, 2) == 2) {
+        s->ultimo = (uint16_t)(dados[0] << 8 | dados[1]) & s->mascara;
+    }
+    return s->ultimo;
+}
+
+/**
+ * Escrita do display pelo gerenciador do barramento
+ */
+int Escrever_display(void *cliente, uint8_t endereco_i2c, const uint8_t *dados, size_t n) {
+    return barramento_escrever(cliente, dados, n);
+}
+
+/**
+ * Inicialização do ADC (GPIO 26 + entrada) para os canais ADC cadastrados
+ */
+void Inicializar_adc() {
+    adc_init();
+    for (uint8_t i = 0; i < canais.n; i++) {
+        if (canais.fonte[i] == FONTE_ADC) {
+            adc_gpio_init(26 + canais.entrada[i]);
+        }
+    }
+}
+
+// Temporização da aquisição: o timer acorda a task, que processa as amostras do disparo
+typedef struct {
+    repeating_timer_t timer;
+    volatile uint32_t taxa_hz;
+    volatile uint32_t por_disparo_q16; // Amostras por disparo do timer (Q16)
+    volatile uint32_t amostras;        // Amostras processadas
+    volatile uint32_t atrasos;         // Amostras perdidas por disparos acumulados
+} Amostragem;
+
+Amostragem amostragem;
+TaskHandle_t tarefa_aquisicao;
+
+#if MODO_ESTRESSE
+Gerador_carga gerador_carga;
+
+/**
+ * Leitor sintético que substitui o ADC no modo de estresse
+ */
+uint16_t NA_RAM(ler_carga)(uint8_t entrada) {
+    return carga_amostra(&gerador_carga, entrada);
+}
+#endif
+
+bool NA_RAM(Amostragem_disparo)(repeating_timer_t *timer) {
+    BaseType_t acordou = pdFALSE;
+    vTaskNotifyGiveFromISR(tarefa_aquisicao, &acordou);
+    portYIELD_FROM_ISR(acordou);
+    return true;
+}
+
+/**
+ * (Re)programa o timer de aquisição para a taxa pedida
+ */
+void Amostragem_definir_taxa(uint32_t hz) {
+    int64_t periodo_us = 1000000 / hz;
+    if (periodo_us < AMOSTRAGEM_TICK_MIN_US) {
+        periodo_us = AMOSTRAGEM_TICK_MIN_US;
+    }
+
+    cancel_repeating_timer(&amostragem.timer);
+    saude_periodo(&saude, saude_aquisicao, (uint32_t)periodo_us, (uint32_t)periodo_us);
+    amostragem.taxa_hz = hz;
+    amostragem.por_disparo_q16 = (uint32_t)(((uint64_t)hz * periodo_us << 16) / 1000000);
+    // Período negativo: conta de início a início, sem acumular o tempo do callback
+    add_repeating_timer_us(-periodo_us, Amostragem_disparo, NULL, &amostragem.timer);
+}
+
+/**
+ * Lê, processa e distribui uma amostra de todos os canais
+ */
+void NA_RAM(Processar_amostra)(Dados_analogicos *Dados, uint8_t *estado_anterior) {
+    // Leitura, calibração e classificação de todos os canais
+    Dados->instante_us = time_us_32();
+    XIP_MEDIR(XIP_AQUISICAO, canais_adquirir(&canais, Dados->bruto));
+    XIP_MEDIR(XIP_FILTRO, filtro_aplicar(&filtro, Dados->bruto, canais.n));
+    XIP_MEDIR(XIP_CANAIS, canais_processar(&canais, Dados));
+    boot_marcar(BOOT_PRIMEIRA_AMOSTRA);
+    XIP_MEDIR(XIP_HISTORICO, historico_amostra(&historico, Dados->instante_us, Dados->valor));
+
+    // Telemetria: amostra e mudanças de estado de cada canal (nunca bloqueia)
+    XIP_INICIO(marca_telemetria);
+    telemetria_publicar_amostra(&anel_telemetria, Dados);
+    for (uint8_t i = 0; i < Dados->n; i++) {
+        if (Dados->estado[i] != estado_anterior[i]) {
+            telemetria_publicar_evento(&anel_telemetria, Dados->instante_us, i,
+                                       estado_anterior[i], Dados->estado[i], Dados->valor[i]);
+            estado_anterior[i] = Dados->estado[i];
+        }
+    }
+    XIP_FIM(XIP_TELEMETRIA, marca_telemetria);
+
+    // Cada consumidor tem a própria entrega; todos veem a amostra mais recente
+    XIP_INICIO(marca_entregas);
+    entrega_enviar(&entrega_display, Dados);
+    entrega_enviar(&entrega_leds, Dados);
+    entrega_enviar(&entrega_matriz, Dados);
+    entrega_enviar(&entrega_buzzer, Dados);
+#if ESCALA_RELOGIO
+    entrega_enviar(&entrega_relogio, Dados);
+#endif
+    XIP_FIM(XIP_ENTREGAS, marca_entregas);
+    amostragem.amostras++;
+
+#if MODO_ESTRESSE
+    carga_avancar(&gerador_carga);
+#endif
+}
+
+/**
+ * Copia os limiares da configuração para a tabela de canais e reprograma
+ * a taxa de aquisição (no modo de estresse a taxa é da busca)
+ */
+void Aplicar_config(const Config_estacao *cfg) {
+    for (uint8_t i = 0; i < cfg->n && i < canais.n; i++) {
+        canais.limiar_atencao[i] = cfg->limiar_atencao[i];
+        canais.limiar_alerta[i] = cfg->limiar_alerta[i];
+    }
+#if !MODO_ESTRESSE
+    if (cfg->amostragem_hz != amostragem.taxa_hz) {
+        Amostragem_definir_taxa(cfg->amostragem_hz);
+    }
+#endif
+}
+
+/**
+ * Task para leitura dos canais de medição
+ */
+void vJoystickTask(void *params) {
+    boot_marcar(BOOT_AGENDADOR);
+
+    Dados_analogicos Dados;
+    uint8_t estado_anterior[CANAIS_MAX] = {ESTADO_NORMAL};
+    uint32_t acumulado_q16 = 0; // Fração de amostra que sobrou dos disparos anteriores
+    const Config_estacao *cfg = config_atual(&config);
+    uint32_t versao_config = cfg->versao;
+
+    Amostragem_definir_taxa(cfg->amostragem_hz);
+    Aplicar_config(cfg);
+
+    while (true) {
+        uint32_t disparos = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        saude_inicio(&saude, saude_aquisicao, time_us_32());
+
+        // Configuração nova: só esta task escreve os limiares da tabela
+        cfg = config_atual(&config);
+        if (cfg->versao != versao_config) {
+            versao_config = cfg->versao;
+            Aplicar_config(cfg);
+        }
+
+        uint32_t por_disparo_q16 = amostragem.por_disparo_q16;
+
+        // Disparos acumulados: a task não acompanhou o timer e essas amostras se perderam
+        if (disparos > 1) {
+            amostragem.atrasos += (disparos - 1) * ((por_disparo_q16 + 0xFFFF) >> 16);
+        }
+
+        acumulado_q16 += por_disparo_q16;
+        uint32_t n = acumulado_q16 >> 16;
+        acumulado_q16 &= 0xFFFF;
+
+        for (uint32_t k = 0; k < n; k++) {
+            Processar_amostra(&Dados, estado_anterior);
+        }
+        saude_fim(&saude, saude_aquisicao, time_us_32());
+    }
+}
+
+// ================= LAYOUT DO DISPLAY =================
+#define PAINEL_TROCA_US 3000000 // Tempo de cada tela quando há mais de 2 canais
+#define DISPLAY_QUADRO_MS 100   // Período fixo de quadros do display (10 fps)
+#define TELA_PAINEL_MS 1000     // Tempo do painel entre as telas de alerta
+#define TELA_ALERTA_MS 1000     // Tempo de cada tela de alerta
+#define TELA_PAINEL_GRAFICO_MS 10000 // Tempo do painel antes dos gráficos de histórico
+#define TELA_GRAFICO_MS 3000    // Tempo do gráfico de cada canal
+#define GRAFICO_NIVEL 1         // Nível do histórico nos gráficos (baldes de 1 min, ~2 h)
+
+typedef enum {
+    TELA_PAINEL,
+    TELA_GRAFICO,
+    TELA_ALERTA
+} TelaDisplay;
+
+// Contadores do laço de quadros do display
+typedef struct {
+    uint32_t quadros;        // Quadros enviados
+    uint32_t perdidos;       // Períodos pulados por atraso
+    uint32_t tempo_us;       // Duração do último quadro (desenho + envio)
+    uint32_t tempo_max_us;   // Maior duração observada
+} Estatisticas_display;
+
+volatile Estatisticas_display estatisticas_display;
+
+/**
+ * Busca a n-ésima tela de alerta (canais em alerta de dois em dois).
+ * Retorna false se não houver essa tela na amostra atual.
+ */
+bool Tela_alerta(const Dados_analogicos *Dados, uint8_t n, const char **linha1, const char **linha2) {
+    uint8_t encontrados = 0;
+    *linha1 = NULL;
+    *linha2 = NULL;
+
+    for (uint8_t i = 0; i < Dados->n; i++) {
+        if (Dados->estado[i] != ESTADO_ALERTA) {
+            continue;
+        }
+        if (encontrados / 2 == n) {
+            if (*linha1 == NULL) {
+                *linha1 = canais.mensagem_alerta[i];
+            } else {
+                *linha2 = canais.mensagem_alerta[i];
+            }
+        }
+        encontrados++;
+    }
+    return *linha1 != NULL;
+}
+
+/**
+ * Tarefa para exibição no display OLED
+ *
+ * Laço de quadros com período fixo: cada quadro pega a amostra mais recente
+ * e desenha a tela atual da máquina de estados (painel, gráficos de
+ * histórico ou alerta). Nada
+ * bloqueia além do envio I2C, então o display nunca fica para trás da fila.
+ * O framebuffer sai em blocos pelo gerenciador do barramento, e leituras de
+ * sensor passam na frente entre um bloco e outro.
+ */
+void vDisplayTask(void *params)
+{
+    // Configuração inicial do display OLED
+    ssd1306_t ssd;
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, endereco, I2C_PORT);
+    ssd1306_set_writer(&ssd, Escrever_display, cliente_display);
+    ssd1306_config(&ssd);
+    boot_marcar(BOOT_DISPLAY);
+
+    Dados_analogicos Dados = {0}; // Amostra mais recente dos canais
+    TelaDisplay tela = TELA_PAINEL;
+    uint8_t tela_alerta = 0;      // Índice da tela de alerta atual
+    uint8_t tela_grafico = 0;     // Canal do gráfico atual
+    const TickType_t periodo = pdMS_TO_TICKS(DISPLAY_QUADRO_MS);
+    TickType_t despertar = xTaskGetTickCount();
+    TickType_t inicio_tela = despertar;
+    
+    while (true)
+    {
+        uint32_t inicio_quadro = time_us_32();
+        const char *linha1, *linha2;
+        saude_inicio(&saude, saude_display, inicio_quadro);
+
+        // Amostra nova, se houver (não bloqueia)
+        entrega_receber(&entrega_display, &Dados, 0);
+
+        /* ========== MÁQUINA DE ESTADOS DAS TELAS ========== */
+        TickType_t na_tela = despertar - inicio_tela;
+        if (tela == TELA_PAINEL) {
+            if (Dados.estado_global == ESTADO_ALERTA && na_tela >= pdMS_TO_TICKS(TELA_PAINEL_MS)) {
+                tela = TELA_ALERTA;
+                tela_alerta = 0;
+                inicio_tela = despertar;
+            } else if (Dados.estado_global != ESTADO_ALERTA && historico.canais > 0 &&
+                       na_tela >= pdMS_TO_TICKS(TELA_PAINEL_GRAFICO_MS)) {
+                tela = TELA_GRAFICO;
+                tela_grafico = 0;
+                inicio_tela = despertar;
+            }
+        } else if (tela == TELA_GRAFICO) {
+            // Alerta interrompe os gráficos; senão passa por um canal de cada vez
+            if (Dados.estado_global == ESTADO_ALERTA) {
+                tela = TELA_ALERTA;
+                tela_alerta = 0;
+                inicio_tela = despertar;
+            } else if (na_tela >= pdMS_TO_TICKS(TELA_GRAFICO_MS)) {
+                inicio_tela = despertar;
+                if (++tela_grafico >= historico.canais) {
+                    tela = TELA_PAINEL;
+                }
+            }
+        } else if (na_tela >= pdMS_TO_TICKS(TELA_ALERTA_MS)) {
+            // Próxima tela de alerta; depois da última volta ao painel
+            tela_alerta++;
+            inicio_tela = despertar;
+            if (!Tela_alerta(&Dados, tela_alerta, &linha1, &linha2)) {
+                tela = TELA_PAINEL;
+            }
+        }
+
+        // O alerta pode ter terminado no meio da tela
+        if (tela == TELA_ALERTA && !Tela_alerta(&Dados, tela_alerta, &linha1, &linha2)) {
+            tela = TELA_PAINEL;
+            inicio_tela = despertar;
+        }
+
+        /* ========== DESENHO DO QUADRO ========== */
+        XIP_INICIO(marca_desenho);
+        if (tela == TELA_PAINEL) {
+            // Com mais de 2 canais o painel alterna entre telas
+            uint8_t telas = (Dados.n + CANAIS_POR_TELA - 1) / CANAIS_POR_TELA;
+            uint8_t primeiro = telas > 1 ? (Dados.instante_us / PAINEL_TROCA_US) % telas * CANAIS_POR_TELA : 0;
+
+            // Rótulos, barras e alertas vêm pré-renderizados de painel_assets.h
+            painel_dashboard(&ssd, &canais, &Dados, primeiro);
+        } else if (tela == TELA_GRAFICO) {
+            // Envelope mínimo/máximo das últimas 128 colunas do histórico
+            painel_grafico(&ssd, &canais, &historico, GRAFICO_NIVEL, tela_grafico);
+        } else {
+            painel_alerta(&ssd, linha1, linha2);
+        }
+        XIP_FIM(XIP_DESENHO, marca_desenho);
+        XIP_MEDIR(XIP_ENVIO, ssd1306_send_data(&ssd)); // Envia buffer para o display
+        boot_marcar(BOOT_PRIMEIRO_QUADRO);
+
+        /* ========== TEMPO DE QUADRO ========== */
+        saude_fim(&saude, saude_display, time_us_32());
+        uint32_t tempo = time_us_32() - inicio_quadro;
+        estatisticas_display.quadros++;
+        estatisticas_display.tempo_us = tempo;
+        if (tempo > estatisticas_display.tempo_max_us) {
+            estatisticas_display.tempo_max_us = tempo;
+        }
+
+        // Se o quadro estourou o período, conta e pula os quadros perdidos
+        TickType_t decorrido = xTaskGetTickCount() - despertar;
+        if (decorrido >= periodo) {
+            estatisticas_display.perdidos += decorrido / periodo;
+            despertar += (decorrido / periodo) * periodo;
+        }
+        vTaskDelayUntil(&despertar, periodo);
+    }
+}
+
+/**
+ * Task para controle dos LEDs PWM
+ */
+void vControle_leds(void *params) {
+    Dados_analogicos Dados;
+    
+    while (true) {
+        if (entrega_receber(&entrega_leds, &Dados, portMAX_DELAY)) {
+            uint slice_red = pwm_gpio_to_slice_num(LED_RED);
+            uint channel_red = pwm_gpio_to_channel(LED_RED);
+            uint slice_green = pwm_gpio_to_slice_num(LED_GREEN);
+            uint channel_green = pwm_gpio_to_channel(LED_GREEN);
+
+            // Controle dos LEDs baseado no pior estado entre os canais
+            if (Dados.estado_global == ESTADO_ALERTA) {
+                // Estado de alerta - LED vermelho aceso
+                pwm_set_chan_level(slice_green, channel_green, 0);
+                pwm_set_chan_level(slice_red, channel_red, 100);
+                boot_marcar(BOOT_PRIMEIRO_ALERTA);
+            } else if (Dados.estado_global == ESTADO_ATENCAO) {
+                // Estado de atenção - ambos LEDs acesos
+                pwm_set_chan_level(slice_green, channel_green, 100);
+                pwm_set_chan_level(slice_red, channel_red, 100);
+            } else {
+                // Estado normal - LED verde aceso
+                pwm_set_chan_level(slice_green, channel_green, 100);
+                pwm_set_chan_level(slice_red, channel_red, 0);
+            }
+
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+    }
+}
+
+/**
+ * Task para controle da matriz de LEDs
+ */
+void vControle_matriz_leds(void *params) {
+    // Inicialização PIO para matriz de LEDs, sem troca de relógio no meio
+    vTaskSuspendAll();
+    pio = pio0;
+    uint offset = pio_add_program(pio, &animacoes_led_program);
+    sm = pio_claim_unused_sm(pio, true);
+    animacoes_led_program_init(pio, sm, offset, LED_MATRIX_PIN);
+
+    // DMA: palavras de 32 bits do quadro para a FIFO TX, no ritmo do PIO
+    dma_matriz = dma_claim_unused_channel(true);
+    dma_channel_config dma_cfg = dma_channel_get_default_config(dma_matriz);
+    channel_config_set_transfer_data_size(&dma_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&dma_cfg, true);
+    channel_config_set_write_increment(&dma_cfg, false);
+    channel_config_set_dreq(&dma_cfg, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma_matriz, &dma_cfg, &pio->txf[sm], quadro_matriz, NUM_PIXELS, false);
+    matriz_pronta = true;
+    xTaskResumeAll();
+
+    cores_definir_brilho(MATRIZ_BRILHO);
+    boot_marcar(BOOT_MATRIZ);
+
+    Dados_analogicos Dados;
+
+    while (true) {
+        if (entrega_receber(&entrega_matriz, &Dados, portMAX_DELAY)) {
+            if (Dados.estado_global == ESTADO_ALERTA) {
+                // Animação de alerta
+                current_pattern = 0;
+                Desenho_matriz_leds_cor(COR_VERMELHO);
+                sleep_ms(500);
+
+                current_pattern = 1;
+                Desenho_matriz_leds_cor(COR_VERDE);
+                sleep_ms(500);
+
+                current_pattern = 2;
+                Desenho_matriz_leds_cor(COR_AZUL);
+                sleep_ms(500);
+            } else {
+                // Estado normal - LEDs apagados
+                current_pattern = 3;
+                Desenho_matriz_leds((Cor_rgb){0, 0, 0});
+                sleep_ms(1000);
+            }
+
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+    }
+}
+
+/**
+ * Task para controle do buzzer
+ */
+void vControle_buzzer(void *params) {
+    Dados_analogicos Dados;
+
+    while (true) {
+        if (entrega_receber(&entrega_buzzer, &Dados, portMAX_DELAY)) {
+            if (Dados.estado_global == ESTADO_ALERTA) {
+                Som_estado_alerta();
+            } else if (Dados.estado_global == ESTADO_ATENCAO) {
+                Som_estado_atencao();
+            } else {
+                gpio_put(BUZZER_PIN, 0);
+                sleep_ms(100);
+            }
+
+            sleep_ms(50);
+        }
+    }
+}
+
+// ================= ESCALA DO RELÓGIO =================
+
+/**
+ * LEDs e buzzer: mesmo PWM em qualquer clk_sys (o nível do buzzer é
+ * relativo ao wrap, que não muda)
+ */
+void Relogio_pwm(EventoRelogio evento, uint32_t sys_hz, void *contexto) {
+    if (evento != RELOGIO_DEPOIS) {
+        return;
+    }
+    float div_leds = sys_hz / (float)(LED_PWM_HZ * (LED_PWM_WRAP + 1));
+    pwm_set_clkdiv(pwm_gpio_to_slice_num(LED_RED), div_leds);
+    pwm_set_clkdiv(pwm_gpio_to_slice_num(LED_GREEN), div_leds);
+    pwm_set_clkdiv(pwm_gpio_to_slice_num(BUZZER_PIN), sys_hz / (float)BUZZER_CONTADOR_HZ);
+}
+
+/**
+ * Matriz: o quadro em andamento termina na frequência antiga; o PIO volta
+ * a 8 MHz na nova. O agendador ainda roda durante RELOGIO_ANTES, então a
+ * task da matriz fica sem disparar quadros até RELOGIO_DEPOIS.
+ */
+void Relogio_matriz(EventoRelogio evento, uint32_t sys_hz, void *contexto) {
+    if (!matriz_pronta) {
+        return;
+    }
+    if (evento == RELOGIO_ANTES) {
+        taskENTER_CRITICAL();
+        matriz_pausada = true;
+        taskEXIT_CRITICAL();
+        dma_channel_wait_for_finish_blocking(dma_matriz);
+        while (!pio_sm_is_tx_fifo_empty(pio, sm)) {
+            tight_loop_contents();
+        }
+        busy_wait_us(30); // Última palavra saindo do registrador de deslocamento (24 bits)
+    } else if (evento == RELOGIO_DEPOIS) {
+        pio_sm_set_clkdiv(pio, sm, animacoes_led_clkdiv(sys_hz));
+        matriz_pausada = false;
+    }
+}
+
+/**
+ * I2C: o clk_peri segue o clk_sys; a troca espera a transação em
+ * andamento e a frequência é recalculada na próxima. O barramento só é
+ * liberado com o agendador retomado (é um mutex).
+ */
+void Relogio_i2c(EventoRelogio evento, uint32_t sys_hz, void *contexto) {
+    if (evento == RELOGIO_ANTES) {
+        barramento_pausar(contexto);
+    } else if (evento == RELOGIO_RETOMADO) {
+        barramento_retomar(contexto);
+    }
+}
+
+/**
+ * Task que ajusta o clk_sys ao pior estado entre os canais
+ */
+void vRelogioTask(void *params) {
+    Dados_analogicos Dados;
+    uint8_t estado = relogio.nivel; // Até a primeira amostra, mantém a frequência de boot
+
+    while (true) {
+        if (entrega_receber(&entrega_relogio, &Dados, pdMS_TO_TICKS(RELOGIO_VERIFICAR_MS))) {
+            estado = Dados.estado_global;
+        }
+        uint32_t agora = time_us_32();
+        relogio_contabilizar(&relogio, agora);
+        relogio_trocar(&relogio, relogio_decidir(&relogio, estado, agora));
+    }
+}
+
+// Resultado do último passo do modo de estresse, enviado pela telemetria
+typedef struct {
+    volatile uint32_t passo;     // Incrementa a cada taxa testada
+    volatile uint32_t taxa_hz;
+    volatile uint32_t amostras;
+    volatile uint32_t perdas;
+    volatile uint32_t descartados_telemetria; // Anel cheio pela USB; não conta como perda
+    volatile uint32_t maior_ok;  // Maior taxa sem perdas até agora
+    volatile bool concluida;
+} Resultado_estresse;
+
+volatile Resultado_estresse resultado_estresse;
+
+/**
+ * Soma de tudo que o pipeline perdeu: disparos atrasados, entregas e
+ * quadros pulados pelo display. O anel de telemetria fica de fora: ele
+ * enche quando a USB não tem host lendo ou está no limite da CDC, e isso
+ * mediria o host em vez do conjunto de tasks; vai separado no TELEM_ESTRESSE.
+ */
+uint32_t Perdas_pipeline() {
+    return amostragem.atrasos +
+           entrega_perdas(&entrega_display) + entrega_perdas(&entrega_leds) +
+           entrega_perdas(&entrega_matriz) + entrega_perdas(&entrega_buzzer) +
+           estatisticas_display.perdidos;
+}
+
+#if MODO_ESTRESSE
+/**
+ * Task do modo de estresse: busca a maior taxa que o conjunto de tasks
+ * sustenta sem perdas e fica nela ao terminar
+ */
+void vEstresseTask(void *params) {
+    Busca_taxa busca;
+    busca_iniciar(&busca, AMOSTRAGEM_HZ, CARGA_ADC_MAX_HZ);
+
+    while (!busca.concluida) {
+        Amostragem_definir_taxa(busca.taxa_hz);
+        uint32_t amostras = amostragem.amostras;
+        uint32_t perdas = Perdas_pipeline();
+        uint32_t descartados = anel_telemetria.descartados;
+
+        vTaskDelay(pdMS_TO_TICKS(ESTRESSE_PASSO_MS));
+
+        amostras = amostragem.amostras - amostras;
+        perdas = Perdas_pipeline() - perdas;
+        descartados = anel_telemetria.descartados - descartados;
+        busca_registrar(&busca, perdas);
+
+        resultado_estresse.taxa_hz = amostragem.taxa_hz;
+        resultado_estresse.amostras = amostras;
+        resultado_estresse.perdas = perdas;
+        resultado_estresse.descartados_telemetria = descartados;
+        resultado_estresse.maior_ok = busca.maior_ok;
+        resultado_estresse.concluida = busca.concluida;
+        resultado_estresse.passo++;
+    }
+
+    Amostragem_definir_taxa(busca.maior_ok ? busca.maior_ok : AMOSTRAGEM_HZ);
+    vTaskDelete(NULL);
+}
+#endif
+
+// ================= CONFIGURAÇÃO DE CAMPO =================
+
+// Registro da configuração no último setor da flash
+typedef struct {
+    uint32_t magica;
+    uint16_t tamanho;          // sizeof(Config_estacao) do firmware que gravou
+    uint16_t crc;
+    Config_estacao config;
+} Config_flash;
+
+_Static_assert(sizeof(Config_flash) <= FLASH_PAGE_SIZE, "configuração maior que uma página da flash");
+
+/**
+ * Lê a configuração gravada; false se o setor estiver vazio, corrompido
+ * ou tiver sido gravado por um firmware com outro formato
+ */
+bool Config_carregar_flash(Config_estacao *c) {
+    const Config_flash *f = (const Config_flash *)(XIP_BASE + CONFIG_FLASH_OFFSET);
+    if (f->magica != CONFIG_MAGICA || f->tamanho != sizeof(Config_estacao) ||
+        f->crc != telemetria_crc16((const uint8_t *)&f->config, sizeof(Config_estacao))) {
+        return false;
+    }
+    *c = f->config;
+    return true;
+}
+
+/**
+ * Grava a configuração se ela mudou. Apagar o setor leva dezenas de ms com
+ * as interrupções desligadas (nada pode rodar da flash nesse tempo), então
+ * a aquisição pode atrasar um disparo a cada gravação.
+ */
+bool Config_salvar_flash(const Config_estacao *c) {
+    static union {
+        Config_flash registro;
+        uint8_t bytes[FLASH_PAGE_SIZE];
+    } pagina;
+    const uint8_t *gravada = (const uint8_t *)(XIP_BASE + CONFIG_FLASH_OFFSET);
+
+    memset(pagina.bytes, 0xFF, sizeof(pagina.bytes));
+    pagina.registro.magica = CONFIG_MAGICA;
+    pagina.registro.tamanho = sizeof(Config_estacao);
+    pagina.registro.config = *c;
+    pagina.registro.crc = telemetria_crc16((const uint8_t *)&pagina.registro.config, sizeof(Config_estacao));
+
+    if (memcmp(pagina.bytes, gravada, sizeof(Config_flash)) == 0) {
+        return true;
+    }
+
+    uint32_t interrupcoes = save_and_disable_interrupts();
+    flash_range_erase(CONFIG_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(CONFIG_FLASH_OFFSET, pagina.bytes, FLASH_PAGE_SIZE);
+    restore_interrupts(interrupcoes);
+
+    return memcmp(pagina.bytes, gravada, sizeof(Config_flash)) == 0;
+}
+
+/**
+ * Trata um quadro de comando do host: itens + CRC-16 em COBS. Sem itens, o
+ * comando só consulta a versão ativa. A resposta vai no registro TELEM_CONFIG.
+ */
+void Processar_comando_config(const uint8_t *bloco, size_t n, uint32_t *resposta) {
+    uint8_t itens[CONFIG_QUADRO_MAX];
+    size_t m = cobs_decodificar(bloco, n, itens);
+    ResultadoConfig resultado = CONFIG_OK;
+    bool gravada = false;
+
+    if (m < 2 || telemetria_crc16(itens, m - 2) != (uint16_t)(itens[m - 2] | itens[m - 1] << 8)) {
+        resultado = CONFIG_ERRO_CRC;
+    } else if (m > 2) {
+        resultado = config_atualizar(&config, itens, m - 2, time_us_32());
+    }
+
+    const Config_estacao *cfg = config_atual(&config);
+    if (resultado == CONFIG_OK && m > 2) {
+        gravada = Config_salvar_flash(cfg);
+    }
+
+    resposta[0] = resultado;
+    resposta[1] = cfg->versao;
+    resposta[2] = cfg->amostragem_hz;
+    resposta[3] = gravada;
+}
+
+/**
+ * Registros de uma task monitorada: parte 0 é o resumo, 1 e 2 são os
+ * histogramas de atraso de ativação e de tempo de execução
+ */
+size_t Registro_saude(uint8_t tarefa, uint8_t parte, uint8_t *registro) {
+    const Monitor_tarefa *m = &saude.tarefas[tarefa];
+    if (parte == 0) {
+        const uint32_t valores[] = {
+            tarefa, m->ativacoes, m->perdas, m->atraso_max_us, m->execucao_max_us, m->ultimo_estouro_us
+        };
+        return telemetria_valores(TELEM_SAUDE, time_us_32(), valores, 6, registro);
+    }
+
+    // Contagens acumuladas módulo 2^16: o host calcula a diferença entre relatórios
+    const volatile uint32_t *hist = parte == 1 ? m->hist_atraso : m->hist_execucao;
+    uint8_t dados[2 + 2 * SAUDE_BALDES];
+    dados[0] = tarefa;
+    dados[1] = parte - 1;
+    for (uint8_t k = 0; k < SAUDE_BALDES; k++) {
+        uint32_t contagem = hist[k];
+        dados[2 + 2 * k] = (uint8_t)contagem;
+        dados[3 + 2 * k] = (uint8_t)(contagem >> 8);
+    }
+    return telemetria_bytes(TELEM_HISTOGRAMA, time_us_32(), dados, sizeof(dados), registro);
+}
+
+/**
+ * Registro com um valor e o nome de uma task (pilha livre ou falha)
+ */
+size_t Registro_nome(TipoTelemetria tipo, uint32_t valor, const char *nome, uint8_t *registro) {
+    uint8_t dados[4 + FALHA_NOME_MAX];
+    uint8_t n = 4;
+    dados[0] = (uint8_t)valor;
+    dados[1] = (uint8_t)(valor >> 8);
+    dados[2] = (uint8_t)(valor >> 16);
+    dados[3] = (uint8_t)(valor >> 24);
+    while (n < sizeof(dados) && nome[n - 4] != '\0') {
+        dados[n] = (uint8_t)nome[n - 4];
+        n++;
+    }
+    return telemetria_bytes(tipo, time_us_32(), dados, n, registro);
+}
+
+/**
+ * Task de baixa prioridade que envia a telemetria pela USB CDC
+ *
+ * Só escreve quando o quadro inteiro cabe no buffer da USB; se o host
+ * parar de ler, o anel enche e o produtor passa a descartar e contar.
+ */
+void vTelemetriaTask(void *params) {
+    Registro_telemetria registro;
+    Contadores_envio envio = {0};
+    uint8_t quadro[TELEM_QUADRO_MAX];
+    size_t tamanho = 0; // Quadro pronto aguardando espaço na USB
+    TickType_t ultimo_contador = xTaskGetTickCount();
+    bool display_pendente = false; // Estatísticas do display vão logo após os contadores
+    uint8_t i2c_pendentes = 0;     // Clientes do barramento ainda não reportados nesta rodada
+    uint8_t saude_pendentes = 0;   // Registros de saúde (3 por task monitorada) desta rodada
+    uint8_t pilhas_pendentes = 0;  // Tasks com pilha ainda não reportada nesta rodada
+    uint8_t xip_pendentes = 0;     // Estágios do perfil XIP ainda não reportados nesta rodada
+    bool relogio_pendente = false; // Escala do relógio ainda não reportada nesta rodada
+    bool falha_pendente = falha_anterior.magica == FALHA_MAGICA;
+    uint32_t fases_enviadas = 0;   // Bit por FaseBoot já reportada
+    uint32_t estresse_enviado = 0; // Último passo do modo de estresse reportado
+    uint8_t comando[CONFIG_QUADRO_MAX]; // Quadro de configuração chegando do host
+    size_t n_comando = 0;
+    uint32_t resposta_config[4];
+    bool config_pendente = false;
+
+    // Quadros binários: sem tradução de \n para \r\n
+    stdio_set_translate_crlf(&stdio_usb, false);
+
+    while (true) {
+        if (stdio_usb_connected()) {
+            boot_marcar(BOOT_USB);
+        }
+
+        // Comandos de configuração: quadros COBS terminados em 0x00, como a telemetria
+        int c;
+        while (!config_pendente && (c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+            if (c != 0) {
+                if (n_comando < sizeof(comando)) {
+                    comando[n_comando] = (uint8_t)c;
+                }
+                n_comando++; // Quadro longo demais é descartado no delimitador
+            } else {
+                if (n_comando > 0 && n_comando <= sizeof(comando)) {
+                    Processar_comando_config(comando, n_comando, resposta_config);
+                    config_pendente = true;
+                }
+                n_comando = 0;
+            }
+        }
+
+        // Fases de boot já marcadas e ainda não reportadas
+        uint32_t fases_novas = 0;
+        for (uint8_t f = 0; f < BOOT_FASES; f++) {
+            if (boot_marcada(f)) {
+                fases_novas |= 1u << f;
+            }
+        }
+        fases_novas &= ~fases_enviadas;
+
+        if (tamanho == 0) {
+            if (fases_novas != 0) {
+                uint8_t f = __builtin_ctz(fases_novas);
+                const uint32_t valores[] = {f, boot_instante(f), boot_build(), boot_build_alterado()};
+                size_t n = telemetria_valores(TELEM_BOOT, time_us_32(), valores, 4, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                fases_enviadas |= 1u << f;
+            } else if (config_pendente) {
+                size_t n = telemetria_valores(TELEM_CONFIG, time_us_32(), resposta_config, 4, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                config_pendente = false;
+            } else if (falha_pendente) {
+                size_t n = Registro_nome(TELEM_FALHA, falha_anterior.tipo, falha_anterior.nome, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                falha_pendente = false;
+            } else if (Estouro_pendente() >= 0) {
+                uint8_t t = (uint8_t)Estouro_pendente();
+                estouro_pendente[t] = false;
+                size_t n = Registro_saude(t, 0, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (xTaskGetTickCount() - ultimo_contador >= pdMS_TO_TICKS(TELEM_CONTADORES_MS)) {
+                ultimo_contador = xTaskGetTickCount();
+                size_t n = telemetria_contadores(&anel_telemetria, &envio, time_us_32(), registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                display_pendente = true;
+            } else if (display_pendente) {
+                const uint32_t valores[] = {
+                    estatisticas_display.quadros, estatisticas_display.perdidos,
+                    estatisticas_display.tempo_us, estatisticas_display.tempo_max_us
+                };
+                size_t n = telemetria_valores(TELEM_DISPLAY, time_us_32(), valores, 4, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                display_pendente = false;
+                i2c_pendentes = barramento.n_clientes;
+                saude_pendentes = saude.n * 3;
+                pilhas_pendentes = n_tarefas;
+                xip_pendentes = PERFIL_XIP ? XIP_ESTAGIOS : 0;
+                relogio_pendente = ESCALA_RELOGIO;
+            } else if (i2c_pendentes > 0) {
+                uint8_t i = barramento.n_clientes - i2c_pendentes--;
+                const Cliente_i2c *c = &barramento.clientes[i];
+                const uint32_t valores[] = {
+                    i, c->transacoes, c->bytes, c->erros,
+                    c->ocupado_us, c->espera_max_us, barramento.recuperacoes
+                };
+                size_t n = telemetria_valores(TELEM_I2C, time_us_32(), valores, 7, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (saude_pendentes > 0) {
+                uint8_t k = saude.n * 3 - saude_pendentes--;
+                size_t n = Registro_saude(k / 3, k % 3, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (pilhas_pendentes > 0) {
+                TaskHandle_t t = tarefas[n_tarefas - pilhas_pendentes--];
+                uint32_t livre = uxTaskGetStackHighWaterMark(t) * sizeof(StackType_t);
+                size_t n = Registro_nome(TELEM_PILHA, livre, pcTaskGetName(t), registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (xip_pendentes > 0) {
+                uint8_t e = XIP_ESTAGIOS - xip_pendentes--;
+                const uint32_t valores[] = {
+                    e, perfil_xip[e].chamadas, perfil_xip[e].acessos, perfil_xip[e].acertos, perfil_xip[e].tempo_us
+                };
+                size_t n = telemetria_valores(TELEM_XIP, time_us_32(), valores, 5, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (relogio_pendente) {
+                const uint32_t valores[] = {
+                    relogio_khz[relogio.nivel], relogio.trocas, relogio.troca_ultima_us,
+                    relogio.troca_max_us, relogio.programar_max_us, relogio.residencia_ms[0],
+                    relogio.residencia_ms[1], relogio.residencia_ms[2]
+                };
+                size_t n = telemetria_valores(TELEM_RELOGIO, time_us_32(), valores, 8, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+                relogio_pendente = false;
+            } else if (resultado_estresse.passo != estresse_enviado) {
+                estresse_enviado = resultado_estresse.passo;
+                const uint32_t valores[] = {
+                    resultado_estresse.taxa_hz, resultado_estresse.amostras,
+                    resultado_estresse.perdas, resultado_estresse.maior_ok,
+                    resultado_estresse.concluida, resultado_estresse.descartados_telemetria
+                };
+                size_t n = telemetria_valores(TELEM_ESTRESSE, time_us_32(), valores, 6, registro.dados);
+                tamanho = telemetria_quadro(registro.dados, n, envio.seq++, quadro);
+            } else if (telemetria_retirar(&anel_telemetria, &registro)) {
+                tamanho = telemetria_quadro(registro.dados, registro.tamanho, envio.seq++, quadro);
+            }
+        }
+
+        if (tamanho > 0 && stdio_usb_connected() && tud_cdc_write_available() >= tamanho) {
+            fwrite(quadro, 1, tamanho, stdout);
+            fflush(stdout);
+            envio.enviados++;
+            envio.bytes += tamanho;
+            tamanho = 0;
+            continue;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+/**
+ * Handler para interrupção do botão BOOTSEL
+ */
+void NA_RAM(gpio_irq_handler)(uint gpio, uint32_t events) {
+    reset_usb_boot(0, 0);
+}
+
+// ================= FUNÇÃO PRINCIPAL =================
+int main() {
+    boot_marcar(BOOT_MAIN);
+
+    // Falha registrada antes do último reset (estouro de pilha ou heap esgotado)
+    if (falha_registrada.magica == FALHA_MAGICA) {
+        falha_anterior = falha_registrada;
+        falha_registrada.magica = 0;
+    }
+
+    // Cadastro dos canais de medição (limiares em permil)
+    canais_init(&canais);
+#if MODO_ESTRESSE
+    carga_init(&gerador_carga, time_us_32());
+    canais_registrar_leitor(&canais, FONTE_ADC, ler_carga);
+#else
+    canais_registrar_leitor(&canais, FONTE_ADC, ler_adc);
+#endif
+    canais_adicionar(&canais, "CHUVA", "CHUVA INTENSA", FONTE_ADC, 1, 0, 4088, 400, 800); // Eixo X
+    canais_adicionar(&canais, "NIVEL", "NIVEL ELEVADO", FONTE_ADC, 0, 0, 4088, 400, 700); // Eixo Y
+#if HABILITAR_CANAL_ADC2
+    canais_adicionar(&canais, "RIO 2", "RIO 2 ELEVADO", FONTE_ADC, 2, 0, 4088, 400, 700);
+#endif
+
+    // Barramento I2C: o display e os sensores são clientes do gerenciador
+    barramento_criar(&barramento, I2C_PORT, I2C_SDA, I2C_SCL, I2C_BARRAMENTO_HZ);
+    cliente_display = barramento_cliente(&barramento, "display", endereco, DISPLAY_I2C_HZ, I2C_PRIORIDADE_BAIXA);
+    canais_registrar_leitor(&canais, FONTE_EXTERNA, ler_i2c);
+#if HABILITAR_SENSORES_I2C
+    sensores_i2c[0] = (Sensor_i2c){
+        barramento_cliente(&barramento, "pluviometro", PLUVIOMETRO_ENDERECO, SENSORES_I2C_HZ, I2C_PRIORIDADE_ALTA),
+        PLUVIOMETRO_REGISTRADOR, 0xFFFF, 0
+    };
+    sensores_i2c[1] = (Sensor_i2c){
+        barramento_cliente(&barramento, "pressao", PRESSAO_ENDERECO, SENSORES_I2C_HZ, I2C_PRIORIDADE_ALTA),
+        -1, 0x3FFF, 0
+    };
+    // Pulsos por período e contagens de 14 bits (10% a 90% da faixa do sensor)
+    canais_adicionar(&canais, "PLUV", "CHUVA INTENSA", FONTE_EXTERNA, 0, 0, 100, 400, 800);
+    canais_adicionar(&canais, "PRESS", "NIVEL ELEVADO", FONTE_EXTERNA, 1, 1638, 14745, 400, 700);
+#endif
+
+    /* ========== FASE 1: CAMINHO DE ALERTA ========== */
+    // Só registradores: LEDs, buzzer e ADC ficam prontos em microssegundos
+    gpio_init(LED_RED);
+    gpio_init(LED_GREEN);
+    config_PWM(LED_GREEN, Pwm_divisor(LED_PWM_HZ * (LED_PWM_WRAP + 1)), LED_PWM_WRAP);
+    config_PWM(LED_RED, Pwm_divisor(LED_PWM_HZ * (LED_PWM_WRAP + 1)), LED_PWM_WRAP);
+
+    gpio_init(BUZZER_PIN);
+    gpio_set_dir(BUZZER_PIN, GPIO_OUT);
+
+    Inicializar_adc();
+    boot_marcar(BOOT_HW_ALERTA);
+
+    // Configuração do botão BOOTSEL
+    gpio_init(BUTTON_B);
+    gpio_set_dir(BUTTON_B, GPIO_IN);
+    gpio_pull_up(BUTTON_B);
+    gpio_set_irq_enabled_with_callback(BUTTON_B, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
+
+    // USB enumera em segundo plano; nada espera pelo host
+    stdio_init_all();
+
+    telemetria_init(&anel_telemetria);
+    historico_init(&historico, canais.n);
+    filtro_init(&filtro);
+    for (uint8_t i = 0; i < canais.n; i++)
+        filtro_configurar(&filtro, i, FILTRO_MODO, FILTRO_PASSO_MAX);
+
+    // Configuração de campo: a gravada na flash ou a de fábrica
+    Config_estacao config_inicial, config_gravada;
+    config_padrao(&config_inicial, &canais, AMOSTRAGEM_HZ);
+    if (Config_carregar_flash(&config_gravada)) {
+        if (config_gravada.n == canais.n && config_validar(&config_gravada) == CONFIG_OK) {
+            config_inicial = config_gravada;
+        } else {
+            config_inicial.versao = config_gravada.versao + 1; // Canais mudaram: fábrica, sem repetir versão
+        }
+    }
+    config_init(&config, &config_inicial, time_us_32());
+
+    // Entregas de amostras: LEDs, matriz, buzzer e display reagem ao estado
+    // atual, então cada um recebe só a amostra mais recente
+    entrega_criar(&entrega_display, "display", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_leds, "leds", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_matriz, "matriz", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_buzzer, "buzzer", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+
+#if ESCALA_RELOGIO
+    // Escala do relógio: periféricos que dependem do clk_sys/clk_peri
+    entrega_criar(&entrega_relogio, "relogio", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    relogio_init(&relogio, time_us_32());
+    relogio_registrar(&relogio, Relogio_i2c, &barramento);
+    relogio_registrar(&relogio, Relogio_matriz, NULL);
+    relogio_registrar(&relogio, Relogio_pwm, NULL);
+#endif
+
+    // Monitor de prazos: a aquisição acerta o período ao programar o timer
+    saude_init(&saude, Estouro_prazo);
+    saude_aquisicao = saude_registrar(&saude, "aquisicao", 1000000 / AMOSTRAGEM_HZ, 1000000 / AMOSTRAGEM_HZ);
+    saude_display = saude_registrar(&saude, "display", DISPLAY_QUADRO_MS * 1000, DISPLAY_QUADRO_MS * 1000);
+
+    /* ========== FASE 2: TASKS ========== */
+    // Aquisição e alerta têm prioridade; display (I2C) e matriz (PIO/DMA) se
+    // inicializam nas próprias tasks enquanto a aquisição aguarda o período
+    Criar_tarefa(barramento_tarefa, "I2C Task", PILHA_I2C, &barramento, PRIORIDADE_I2C, NULL);
+    Criar_tarefa(vJoystickTask, "Joystick Task", PILHA_AQUISICAO, NULL, PRIORIDADE_AQUISICAO, &tarefa_aquisicao);
+    Criar_tarefa(vControle_leds, "LED red Task", PILHA_ALERTA, NULL, PRIORIDADE_ALERTA, NULL);
+    Criar_tarefa(vControle_buzzer, "Buzzer Task", PILHA_ALERTA, NULL, PRIORIDADE_ALERTA, NULL);
+    Criar_tarefa(vControle_matriz_leds, "Matriz_leds Task", PILHA_ALERTA, NULL, PRIORIDADE_ALERTA, NULL);
+    Criar_tarefa(vDisplayTask, "Display Task", PILHA_DISPLAY, NULL, PRIORIDADE_DISPLAY, NULL);
+    Criar_tarefa(vTelemetriaTask, "Telemetria Task", PILHA_TELEMETRIA, NULL, PRIORIDADE_TELEMETRIA, NULL);
+#if ESCALA_RELOGIO
+    Criar_tarefa(vRelogioTask, "Relogio Task", PILHA_RELOGIO, NULL, PRIORIDADE_RELOGIO, NULL);
+#endif
+#if MODO_ESTRESSE
+    xTaskCreate(vEstresseTask, "Estresse Task", PILHA_ESTRESSE, NULL, PRIORIDADE_ESTRESSE, NULL); // Apaga-se ao terminar
+#endif
+
+    // Inicia o agendador do FreeRTOS
+    vTaskStartScheduler();
+    panic_unsupported();
+}
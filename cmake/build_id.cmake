@@ -0,0 +1,32 @@
+# Gera build_id.h com o commit atual; roda a cada build (alvo build_id).
+# configure_file só reescreve o header quando o commit muda, então um build
+# incremental sem commit novo não recompila nada.
+#
+# O ID tem 32 bits: os 8 primeiros dígitos do hash completo (--short pode
+# devolver mais de 8 quando o prefixo é ambíguo). Alterações não commitadas
+# vão em BOOT_BUILD_ALTERADO, para o build local não se passar pelo commit.
+execute_process(
+        COMMAND git rev-parse HEAD
+        WORKING_DIRECTORY ${FONTE}
+        OUTPUT_VARIABLE BUILD_COMMIT
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+        ERROR_QUIET
+        )
+if (BUILD_COMMIT MATCHES "^[0-9a-f]+$")
+        string(SUBSTRING ${BUILD_COMMIT} 0 8 BUILD_COMMIT)
+        execute_process(
+                COMMAND git diff --quiet HEAD
+                WORKING_DIRECTORY ${FONTE}
+                RESULT_VARIABLE BUILD_SUJO
+                ERROR_QUIET
+                )
+        if (BUILD_SUJO EQUAL 0)
+                set(BUILD_ALTERADO 0)
+        else()
+                set(BUILD_ALTERADO 1)
+        endif()
+        set(BOOT_BUILD_ID_DEFINE "#define BOOT_BUILD_ID 0x${BUILD_COMMIT}u\n#define BOOT_BUILD_ALTERADO ${BUILD_ALTERADO}")
+else()
+        set(BOOT_BUILD_ID_DEFINE "// Sem git: boot_build() usa data e hora da compilação")
+endif()
+configure_file(${FONTE}/cmake/build_id.h.in ${SAIDA})
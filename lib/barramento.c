@@ -0,0 +1,308 @@
+#include "barramento.h"
+#include "ram.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+
+#define I2C_RECUPERACAO_US 5     // Meio período dos pulsos de recuperação (100 kHz)
+
+// Um barramento por controlador, indexado por i2c_hw_index
+static Barramento_i2c *barramentos[2];
+
+/**
+ * STOP ou abort da transação: mascara o controlador e acorda a sua task
+ */
+static void NA_RAM(barramento_irq_i2c)(void) {
+    BaseType_t acordou = pdFALSE;
+    for (int i = 0; i < 2; i++) {
+        Barramento_i2c *b = barramentos[i];
+        if (b != NULL && i2c_get_hw(b->i2c)->intr_stat) {
+            i2c_get_hw(b->i2c)->intr_mask = 0;
+            vTaskNotifyGiveFromISR(b->tarefa, &acordou);
+        }
+    }
+    portYIELD_FROM_ISR(acordou);
+}
+
+/**
+ * Cria filas e semáforos; o hardware é iniciado pela própria task
+ */
+bool barramento_criar(Barramento_i2c *b, i2c_inst_t *i2c, uint8_t sda, uint8_t scl,
+                      uint32_t velocidade_max_hz) {
+    b->i2c = i2c;
+    b->sda = sda;
+    b->scl = scl;
+    b->velocidade_max_hz = velocidade_max_hz;
+    b->velocidade_atual_hz = 0;
+    b->n_clientes = 0;
+    b->recuperacoes = 0;
+    b->tarefa = NULL;
+    b->dma = -1;
+
+    for (int p = 0; p < I2C_PRIORIDADES; p++) {
+        b->filas[p] = xQueueCreate(I2C_CLIENTES_MAX, sizeof(Transacao_i2c *));
+        if (b->filas[p] == NULL)
+            return false;
+    }
+    b->pendentes = xSemaphoreCreateCounting(I2C_CLIENTES_MAX, 0);
+    b->uso = xSemaphoreCreateMutex();
+    return b->pendentes != NULL && b->uso != NULL;
+}
+
+/**
+ * Cadastra um dispositivo; retorna NULL se a tabela estiver cheia
+ */
+Cliente_i2c *barramento_cliente(Barramento_i2c *b, const char *nome, uint8_t endereco,
+                                uint32_t velocidade_hz, PrioridadeI2c prioridade) {
+    if (b->n_clientes >= I2C_CLIENTES_MAX)
+        return NULL;
+
+    Cliente_i2c *c = &b->clientes[b->n_clientes];
+    c->concluida = xSemaphoreCreateBinary();
+    if (c->concluida == NULL)
+        return NULL;
+
+    c->barramento = b;
+    c->nome = nome;
+    c->endereco = endereco;
+    c->velocidade_hz = velocidade_hz;
+    c->prioridade = prioridade;
+    c->transacoes = 0;
+    c->bytes = 0;
+    c->erros = 0;
+    c->ocupado_us = 0;
+    c->espera_max_us = 0;
+    b->n_clientes++;
+    return c;
+}
+
+static void barramento_iniciar_i2c(Barramento_i2c *b) {
+    i2c_init(b->i2c, b->velocidade_max_hz);
+    i2c_get_hw(b->i2c)->intr_mask = 0; // Liberada só durante cada transação
+    b->velocidade_atual_hz = b->velocidade_max_hz;
+    gpio_set_function(b->sda, GPIO_FUNC_I2C);
+    gpio_set_function(b->scl, GPIO_FUNC_I2C);
+    gpio_pull_up(b->sda);
+    gpio_pull_up(b->scl);
+}
+
+// Dreno aberto por software: nível baixo = saída em 0, nível alto = entrada com pull-up
+static void linha_soltar(uint8_t pino, bool solta) {
+    gpio_set_dir(pino, solta ? GPIO_IN : GPIO_OUT);
+    busy_wait_us(I2C_RECUPERACAO_US);
+}
+
+/**
+ * Libera um escravo preso no meio de um byte: pulsos em SCL até a SDA
+ * subir (no máximo 9) e um STOP, depois reinicia o controlador
+ */
+static void barramento_recuperar(Barramento_i2c *b) {
+    i2c_deinit(b->i2c);
+    gpio_set_function(b->sda, GPIO_FUNC_SIO);
+    gpio_set_function(b->scl, GPIO_FUNC_SIO);
+    gpio_put(b->sda, 0);
+    gpio_put(b->scl, 0);
+    linha_soltar(b->sda, true);
+    linha_soltar(b->scl, true);
+
+    for (int i = 0; i < 9 && !gpio_get(b->sda); i++) {
+        linha_soltar(b->scl, false);
+        linha_soltar(b->scl, true);
+    }
+
+    // STOP: SDA sobe com SCL em nível alto
+    linha_soltar(b->scl, false);
+    linha_soltar(b->sda, false);
+    linha_soltar(b->scl, true);
+    linha_soltar(b->sda, true);
+
+    barramento_iniciar_i2c(b);
+    b->recuperacoes++;
+}
+
+/**
+ * Executa a transação como palavras de IC_DATA_CMD: os bytes escritos, os
+ * comandos de leitura (RESTART no primeiro, depois de uma escrita) e STOP
+ * no último. Até a profundidade da FIFO a CPU escreve direto; acima disso
+ * vai por DMA. A task dorme até a interrupção de STOP ou abort e retira
+ * os bytes lidos da FIFO de recepção.
+ */
+static int barramento_transacao_hw(Barramento_i2c *b, uint8_t endereco, Transacao_i2c *t,
+                                   uint32_t limite_us) {
+    i2c_hw_t *hw = i2c_get_hw(b->i2c);
+    size_t n = t->n_escrita + t->n_leitura;
+
+    // Desabilitar também esvazia as FIFOs de uma transação anterior abortada
+    hw->enable = 0;
+    hw->tar = endereco;
+    hw->enable = 1;
+
+    for (size_t i = 0; i < t->n_escrita; i++)
+        b->comandos[i] = t->escrita[i];
+    for (size_t i = 0; i < t->n_leitura; i++)
+        b->comandos[t->n_escrita + i] = I2C_IC_DATA_CMD_CMD_BITS;
+    if (t->n_escrita > 0 && t->n_leitura > 0)
+        b->comandos[t->n_escrita] |= I2C_IC_DATA_CMD_RESTART_BITS;
+    b->comandos[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+
+    ulTaskNotifyTake(pdTRUE, 0); // Descarta aviso atrasado de uma transação expirada
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    bool dma = n > I2C_FIFO;
+    if (dma) {
+        dma_channel_transfer_from_buffer_now(b->dma, b->comandos, n);
+    } else {
+        for (size_t i = 0; i < n; i++)
+            hw->data_cmd = b->comandos[i];
+    }
+
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(limite_us / 1000) + 2) == 0) {
+        hw->intr_mask = 0;
+        if (dma)
+            dma_channel_abort(b->dma);
+        return PICO_ERROR_TIMEOUT;
+    }
+
+    // NACK: a FIFO fica em descarte até clr_tx_abrt, então o DMA para antes
+    bool abortou = hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+    if (abortou && dma)
+        dma_channel_abort(b->dma);
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+    if (abortou || hw->rxflr < t->n_leitura)
+        return PICO_ERROR_GENERIC;
+
+    for (size_t i = 0; i < t->n_leitura; i++)
+        t->leitura[i] = (uint8_t)hw->data_cmd;
+    return (int)n;
+}
+
+static void barramento_executar(Barramento_i2c *b, Transacao_i2c *t) {
+    Cliente_i2c *c = t->cliente;
+    uint32_t inicio = time_us_32();
+
+    // Frequência do cliente, limitada pelo barramento
+    uint32_t hz = c->velocidade_hz < b->velocidade_max_hz ? c->velocidade_hz : b->velocidade_max_hz;
+    if (hz != b->velocidade_atual_hz) {
+        i2c_set_baudrate(b->i2c, hz);
+        b->velocidade_atual_hz = hz;
+    }
+
+    // Prazo: 9 bits por byte na frequência atual, com folga de 2x + 1 ms
+    size_t bytes = t->n_escrita + t->n_leitura;
+    uint32_t limite_us = (uint32_t)(bytes * 9 * 2 * 1000000ull / hz) + 1000;
+
+    int r = barramento_transacao_hw(b, c->endereco, t, limite_us);
+
+    if (r == PICO_ERROR_TIMEOUT)
+        barramento_recuperar(b);
+
+    uint32_t fim = time_us_32();
+    uint32_t espera = inicio - t->enfileirada_us;
+    c->transacoes++;
+    c->ocupado_us += fim - inicio;
+    if (espera > c->espera_max_us)
+        c->espera_max_us = espera;
+    if (r < 0) {
+        c->erros++;
+    } else {
+        c->bytes += bytes;
+    }
+    t->resultado = r;
+}
+
+/**
+ * Task dona do barramento: sempre atende a fila de maior prioridade primeiro
+ */
+void barramento_tarefa(void *params) {
+    Barramento_i2c *b = params;
+    b->tarefa = xTaskGetCurrentTaskHandle();
+    barramento_iniciar_i2c(b);
+
+    b->dma = dma_claim_unused_channel(true);
+    dma_channel_config cfg = dma_channel_get_default_config(b->dma);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, i2c_get_dreq(b->i2c, true));
+    dma_channel_configure(b->dma, &cfg, &i2c_get_hw(b->i2c)->data_cmd, b->comandos, 0, false);
+
+    uint indice = i2c_hw_index(b->i2c);
+    barramentos[indice] = b;
+    irq_set_exclusive_handler(I2C0_IRQ + indice, barramento_irq_i2c);
+    irq_set_enabled(I2C0_IRQ + indice, true);
+
+    while (true) {
+        xSemaphoreTake(b->pendentes, portMAX_DELAY);
+
+        Transacao_i2c *t = NULL;
+        for (int p = 0; p < I2C_PRIORIDADES && t == NULL; p++) {
+            if (xQueueReceive(b->filas[p], &t, 0) != pdTRUE)
+                t = NULL;
+        }
+        if (t == NULL)
+            continue;
+
+        xSemaphoreTake(b->uso, portMAX_DELAY);
+        barramento_executar(b, t);
+        xSemaphoreGive(b->uso);
+        xSemaphoreGive(t->cliente->concluida);
+    }
+}
+
+/**
+ * Espera a transação em andamento terminar e segura o barramento (ex.: para
+ * trocar o clk_peri, que define a frequência do I2C)
+ */
+void barramento_pausar(Barramento_i2c *b) {
+    xSemaphoreTake(b->uso, portMAX_DELAY);
+}
+
+/**
+ * Libera o barramento; a frequência é reprogramada na próxima transação
+ * com o clk_peri atual. Não bloqueia, mas usa o FreeRTOS: não chamar com o
+ * agendador suspenso.
+ */
+void barramento_retomar(Barramento_i2c *b) {
+    b->velocidade_atual_hz = 0;
+    xSemaphoreGive(b->uso);
+}
+
+/**
+ * Enfileira a transação e bloqueia até a task do barramento executá-la.
+ * Retorna os bytes transferidos ou PICO_ERROR_*.
+ */
+int barramento_transferir(Cliente_i2c *c, const uint8_t *escrita, size_t n_escrita,
+                          uint8_t *leitura, size_t n_leitura) {
+    if (n_escrita > I2C_TRANSACAO_MAX || n_leitura > I2C_LEITURA_MAX || n_escrita + n_leitura == 0)
+        return PICO_ERROR_GENERIC;
+
+    Transacao_i2c t = {
+        .cliente = c,
+        .escrita = escrita,
+        .n_escrita = n_escrita,
+        .leitura = leitura,
+        .n_leitura = n_leitura,
+        .enfileirada_us = time_us_32(),
+        .resultado = PICO_ERROR_GENERIC
+    };
+    Transacao_i2c *p = &t;
+
+    xQueueSend(c->barramento->filas[c->prioridade], &p, portMAX_DELAY);
+    xSemaphoreGive(c->barramento->pendentes);
+    xSemaphoreTake(c->concluida, portMAX_DELAY);
+    return t.resultado;
+}
+
+int barramento_escrever(Cliente_i2c *c, const uint8_t *dados, size_t n) {
+    return barramento_transferir(c, dados, n, NULL, 0);
+}
+
+/**
+ * Lê n bytes a partir do registrador (registrador < 0: leitura direta)
+ */
+int barramento_ler(Cliente_i2c *c, int16_t registrador, uint8_t *dados, size_t n) {
+    uint8_t reg = (uint8_t)registrador;
+    return barramento_transferir(c, &reg, registrador < 0 ? 0 : 1, dados, n);
+}
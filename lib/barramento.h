@@ -0,0 +1,100 @@
+#ifndef BARRAMENTO_H
+#define BARRAMENTO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "hardware/i2c.h"
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+#include "task.h"
+
+/**
+ * Gerenciador do barramento I2C compartilhado (display, sensores...)
+ *
+ * Uma task dona do barramento executa as transações dos clientes em ordem
+ * de prioridade: leituras de sensor (I2C_PRIORIDADE_ALTA) passam na frente
+ * das escritas do framebuffer, que o display envia em blocos. Transações
+ * que cabem na FIFO são escritas direto e as maiores vão por DMA; nos dois
+ * casos a task dorme até a interrupção de STOP (ou abort) do controlador,
+ * então não ocupa a CPU durante a transferência apesar da prioridade alta.
+ * Cada cliente roda na maior frequência que ele e o barramento aceitam (até
+ * 1 MHz, Fast-mode Plus). Um barramento travado (SDA presa em nível baixo)
+ * é liberado com 9 pulsos de SCL e um STOP.
+ *
+ * Cada cliente tem no máximo uma transação pendente: use um cliente por task.
+ * Quem troca o clk_peri pausa o barramento entre transações e, ao retomar,
+ * a frequência é recalculada na próxima transação.
+ */
+
+#define I2C_CLIENTES_MAX 4
+#define I2C_TRANSACAO_MAX 256    // Maior escrita aceita (bytes)
+#define I2C_FIFO 16              // Profundidade das FIFOs do controlador; acima disso, DMA
+#define I2C_LEITURA_MAX I2C_FIFO // Os bytes lidos ficam na FIFO de recepção até o STOP
+
+typedef enum {
+    I2C_PRIORIDADE_ALTA,         // Leituras de sensor
+    I2C_PRIORIDADE_BAIXA,        // Display e transferências longas
+    I2C_PRIORIDADES
+} PrioridadeI2c;
+
+typedef struct Barramento_i2c Barramento_i2c;
+
+typedef struct {
+    Barramento_i2c *barramento;
+    const char *nome;
+    uint8_t endereco;
+    uint32_t velocidade_hz;          // Maior frequência aceita pelo dispositivo
+    PrioridadeI2c prioridade;
+    SemaphoreHandle_t concluida;     // Liberado pela task do barramento
+
+    // Estatísticas
+    volatile uint32_t transacoes;
+    volatile uint32_t bytes;
+    volatile uint32_t erros;
+    volatile uint32_t ocupado_us;    // Tempo total ocupando o barramento
+    volatile uint32_t espera_max_us; // Maior espera na fila
+} Cliente_i2c;
+
+typedef struct {
+    Cliente_i2c *cliente;
+    const uint8_t *escrita;
+    size_t n_escrita;
+    uint8_t *leitura;
+    size_t n_leitura;
+    uint32_t enfileirada_us;
+    int resultado;                   // Bytes transferidos ou PICO_ERROR_*
+} Transacao_i2c;
+
+struct Barramento_i2c {
+    i2c_inst_t *i2c;
+    uint8_t sda, scl;
+    uint32_t velocidade_max_hz;      // Limite do barramento (pull-ups, fiação)
+    uint32_t velocidade_atual_hz;
+    QueueHandle_t filas[I2C_PRIORIDADES];
+    SemaphoreHandle_t pendentes;     // Uma unidade por transação enfileirada
+    SemaphoreHandle_t uso;           // Mantido durante cada transação e enquanto pausado
+    TaskHandle_t tarefa;
+    int dma;
+    uint16_t comandos[I2C_TRANSACAO_MAX + I2C_LEITURA_MAX]; // Palavras de IC_DATA_CMD da transação
+
+    Cliente_i2c clientes[I2C_CLIENTES_MAX];
+    uint8_t n_clientes;
+    volatile uint32_t recuperacoes;  // Barramentos travados liberados
+};
+
+bool barramento_criar(Barramento_i2c *b, i2c_inst_t *i2c, uint8_t sda, uint8_t scl,
+                      uint32_t velocidade_max_hz);
+Cliente_i2c *barramento_cliente(Barramento_i2c *b, const char *nome, uint8_t endereco,
+                                uint32_t velocidade_hz, PrioridadeI2c prioridade);
+void barramento_tarefa(void *params);
+void barramento_pausar(Barramento_i2c *b);
+void barramento_retomar(Barramento_i2c *b);
+
+int barramento_transferir(Cliente_i2c *c, const uint8_t *escrita, size_t n_escrita,
+                          uint8_t *leitura, size_t n_leitura);
+int barramento_escrever(Cliente_i2c *c, const uint8_t *dados, size_t n);
+int barramento_ler(Cliente_i2c *c, int16_t registrador, uint8_t *dados, size_t n);
+
+#endif
@@ -0,0 +1,52 @@
+#include "boot.h"
+#include "pico/stdlib.h"
+#include "build_id.h"
+
+static volatile uint32_t instantes[BOOT_FASES]; // 0 = fase ainda não marcada
+
+/**
+ * Marca a fase; só a primeira chamada conta
+ */
+void boot_marcar(FaseBoot fase) {
+    if (instantes[fase] == 0) {
+        uint32_t agora = time_us_32();
+        instantes[fase] = agora ? agora : 1;
+    }
+}
+
+bool boot_marcada(FaseBoot fase) {
+    return instantes[fase] != 0;
+}
+
+uint32_t boot_instante(FaseBoot fase) {
+    return instantes[fase];
+}
+
+/**
+ * Identificador do build: o commit (BOOT_BUILD_ID, gerado em build_id.h a
+ * cada build) ou, sem git, FNV-1a de data e hora da compilação
+ */
+uint32_t boot_build(void) {
+#ifdef BOOT_BUILD_ID
+    return BOOT_BUILD_ID;
+#else
+    const char *s = __DATE__ " " __TIME__;
+    uint32_t h = 2166136261u;
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+#endif
+}
+
+/**
+ * true se o build saiu de uma árvore com alterações fora do commit
+ */
+bool boot_build_alterado(void) {
+#ifdef BOOT_BUILD_ALTERADO
+    return BOOT_BUILD_ALTERADO;
+#else
+    return false;
+#endif
+}
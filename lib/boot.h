@@ -0,0 +1,34 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Marcas de tempo das fases de inicialização
+ *
+ * Cada fase guarda o time_us_32() da primeira vez em que é marcada
+ * (microssegundos desde o reset). Os instantes são enviados pela
+ * telemetria junto com o identificador do build.
+ */
+
+typedef enum {
+    BOOT_MAIN,              // Entrada em main()
+    BOOT_HW_ALERTA,         // LEDs, buzzer e ADC prontos
+    BOOT_AGENDADOR,         // Primeira task em execução
+    BOOT_PRIMEIRA_AMOSTRA,  // Primeira amostra classificada
+    BOOT_PRIMEIRO_ALERTA,   // Primeiro alerta acionado nos LEDs
+    BOOT_MATRIZ,            // PIO e DMA da matriz prontos
+    BOOT_DISPLAY,           // Display configurado
+    BOOT_PRIMEIRO_QUADRO,   // Primeiro quadro enviado ao display
+    BOOT_USB,               // Host USB conectado
+    BOOT_FASES
+} FaseBoot;
+
+void boot_marcar(FaseBoot fase);
+bool boot_marcada(FaseBoot fase);
+uint32_t boot_instante(FaseBoot fase);
+uint32_t boot_build(void);
+bool boot_build_alterado(void);
+
+#endif
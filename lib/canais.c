@@ -0,0 +1,90 @@
+#include "canais.h"
+#include "ram.h"
+#include <stddef.h>
+
+void canais_init(Tabela_canais *t) {
+    t->n = 0;
+    for (int f = 0; f < FONTE_TOTAL; f++)
+        t->leitor[f] = NULL;
+}
+
+void canais_registrar_leitor(Tabela_canais *t, FonteCanal fonte, LeitorCanal leitor) {
+    t->leitor[fonte] = leitor;
+}
+
+/**
+ * Cadastra um canal; zero/fundo são as leituras brutas de 0% e 100%.
+ * Retorna o índice do canal ou -1 se a tabela estiver cheia.
+ */
+int canais_adicionar(Tabela_canais *t, const char *rotulo, const char *mensagem_alerta,
+                     FonteCanal fonte, uint8_t entrada, uint16_t zero, uint16_t fundo,
+                     uint16_t limiar_atencao, uint16_t limiar_alerta) {
+    if (t->n >= CANAIS_MAX || fundo <= zero)
+        return -1;
+
+    uint8_t i = t->n++;
+    t->rotulo[i] = rotulo;
+    t->mensagem_alerta[i] = mensagem_alerta;
+    t->fonte[i] = fonte;
+    t->entrada[i] = entrada;
+    t->zero[i] = zero;
+    t->faixa[i] = fundo - zero;
+    t->ganho_q16[i] = ((uint32_t)CANAIS_ESCALA << 16) / (uint32_t)(fundo - zero);
+    t->limiar_atencao[i] = limiar_atencao;
+    t->limiar_alerta[i] = limiar_alerta;
+    return i;
+}
+
+/**
+ * Lê o valor bruto de todos os canais pela fonte cadastrada
+ */
+void NA_RAM(canais_adquirir)(const Tabela_canais *t, uint16_t *bruto) {
+    for (uint8_t i = 0; i < t->n; i++) {
+        LeitorCanal leitor = t->leitor[t->fonte[i]];
+        bruto[i] = leitor ? leitor(t->entrada[i]) : 0;
+    }
+}
+
+/**
+ * Converte leituras brutas em permil, saturando em 0 e CANAIS_ESCALA
+ */
+void NA_RAM(canais_calibrar)(const Tabela_canais *t, const uint16_t *bruto, uint16_t *valor) {
+    for (uint8_t i = 0; i < t->n; i++) {
+        // Satura antes de multiplicar: d <= faixa mantém o produto em 32 bits
+        int32_t d = (int32_t)bruto[i] - t->zero[i];
+        d = d < 0 ? 0 : d;
+        d = d > t->faixa[i] ? t->faixa[i] : d;
+        uint32_t v = ((uint32_t)d * t->ganho_q16[i]) >> 16;
+        valor[i] = v > CANAIS_ESCALA ? CANAIS_ESCALA : (uint16_t)v;
+    }
+}
+
+/**
+ * Classifica cada canal sem desvios: cada limiar ultrapassado soma um nível
+ */
+void NA_RAM(canais_classificar)(const Tabela_canais *t, const uint16_t *valor, uint8_t *estado) {
+    for (uint8_t i = 0; i < t->n; i++) {
+        estado[i] = (uint8_t)(valor[i] > t->limiar_atencao[i]) +
+                    (uint8_t)(valor[i] > t->limiar_alerta[i]);
+    }
+}
+
+/**
+ * Retorna o pior estado entre os canais
+ */
+uint8_t NA_RAM(canais_estado_global)(const uint8_t *estado, uint8_t n) {
+    uint8_t pior = ESTADO_NORMAL;
+    for (uint8_t i = 0; i < n; i++)
+        pior = estado[i] > pior ? estado[i] : pior;
+    return pior;
+}
+
+/**
+ * Calibra e classifica uma amostra cujos valores brutos já foram lidos
+ */
+void NA_RAM(canais_processar)(const Tabela_canais *t, Dados_analogicos *dados) {
+    dados->n = t->n;
+    canais_calibrar(t, dados->bruto, dados->valor);
+    canais_classificar(t, dados->valor, dados->estado);
+    dados->estado_global = canais_estado_global(dados->estado, t->n);
+}
@@ -0,0 +1,81 @@
+#ifndef CANAIS_H
+#define CANAIS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Tabela de canais de medição (chuva, nível, estações remotas...)
+ *
+ * Os dados ficam em "struct of arrays": cada campo é um vetor indexado
+ * pelo canal, de modo que calibração e classificação sejam laços simples
+ * e contíguos sobre todos os canais.
+ */
+
+#ifndef CANAIS_MAX
+#define CANAIS_MAX 8          // Número máximo de canais por estação
+#endif
+
+#define CANAIS_ESCALA 1000    // Valores calibrados em permil (0-1000 = 0-100%)
+
+typedef enum {
+    ESTADO_NORMAL = 0,
+    ESTADO_ATENCAO = 1,
+    ESTADO_ALERTA = 2
+} EstadoCanal;
+
+typedef enum {
+    FONTE_ADC,        // Entrada ADC interna (ADC0-ADC2)
+    FONTE_EXTERNA,    // Conversor externo (SPI/I2C)
+    FONTE_SIMULADA,   // Estação remota/simulada
+    FONTE_TOTAL
+} FonteCanal;
+
+// Função de leitura de uma fonte; recebe a entrada do canal e devolve o valor bruto
+typedef uint16_t (*LeitorCanal)(uint8_t entrada);
+
+typedef struct {
+    uint8_t n;                                // Canais cadastrados
+
+    // Identificação
+    const char *rotulo[CANAIS_MAX];           // Ex.: "CHUVA"
+    const char *mensagem_alerta[CANAIS_MAX];  // Ex.: "CHUVA INTENSA"
+
+    // Aquisição
+    uint8_t fonte[CANAIS_MAX];
+    uint8_t entrada[CANAIS_MAX];
+    LeitorCanal leitor[FONTE_TOTAL];
+
+    // Calibração: valor = (bruto - zero) * ganho_q16 >> 16
+    uint16_t zero[CANAIS_MAX];
+    uint16_t faixa[CANAIS_MAX];               // fundo - zero
+    uint32_t ganho_q16[CANAIS_MAX];
+
+    // Limiares em permil
+    uint16_t limiar_atencao[CANAIS_MAX];
+    uint16_t limiar_alerta[CANAIS_MAX];
+} Tabela_canais;
+
+// Amostra de todos os canais, trocada entre as tasks pela fila
+typedef struct {
+    uint32_t instante_us;             // Momento da aquisição
+    uint8_t n;                        // Canais válidos nesta amostra
+    uint8_t estado_global;            // Pior estado entre os canais
+    uint16_t bruto[CANAIS_MAX];       // Leitura sem calibração
+    uint16_t valor[CANAIS_MAX];       // Valor calibrado (permil)
+    uint8_t estado[CANAIS_MAX];       // EstadoCanal de cada canal
+} Dados_analogicos;
+
+void canais_init(Tabela_canais *t);
+void canais_registrar_leitor(Tabela_canais *t, FonteCanal fonte, LeitorCanal leitor);
+int canais_adicionar(Tabela_canais *t, const char *rotulo, const char *mensagem_alerta,
+                     FonteCanal fonte, uint8_t entrada, uint16_t zero, uint16_t fundo,
+                     uint16_t limiar_atencao, uint16_t limiar_alerta);
+
+void canais_adquirir(const Tabela_canais *t, uint16_t *bruto);
+void canais_calibrar(const Tabela_canais *t, const uint16_t *bruto, uint16_t *valor);
+void canais_classificar(const Tabela_canais *t, const uint16_t *valor, uint8_t *estado);
+uint8_t canais_estado_global(const uint8_t *estado, uint8_t n);
+void canais_processar(const Tabela_canais *t, Dados_analogicos *dados);
+
+#endif
@@ -0,0 +1,65 @@
+#include "carga.h"
+
+#define CARGA_PERIODO 4096   // Amostras por ciclo do hidrograma
+
+void carga_init(Gerador_carga *g, uint32_t semente) {
+    g->passo = 0;
+    g->semente = semente ? semente : 1;
+}
+
+/**
+ * Leitura sintética do canal no passo atual: rampa sobe e desce em
+ * CARGA_PERIODO amostras, com ruído de +-32 contagens
+ */
+uint16_t carga_amostra(Gerador_carga *g, uint8_t canal) {
+    uint32_t t = (g->passo + canal * (CARGA_PERIODO / 3)) % CARGA_PERIODO;
+    int32_t v = t < CARGA_PERIODO / 2 ? (int32_t)t * 2 : (int32_t)(CARGA_PERIODO - t) * 2;
+
+    g->semente ^= g->semente << 13;
+    g->semente ^= g->semente >> 17;
+    g->semente ^= g->semente << 5;
+    v += (int32_t)(g->semente & 63) - 32;
+
+    return (uint16_t)(v < 0 ? 0 : v > 4095 ? 4095 : v);
+}
+
+void carga_avancar(Gerador_carga *g) {
+    g->passo++;
+}
+
+void busca_iniciar(Busca_taxa *b, uint32_t inicial, uint32_t maxima) {
+    b->taxa_hz = inicial;
+    b->maior_ok = 0;
+    b->menor_falha = 0;
+    b->maxima = maxima;
+    b->concluida = false;
+}
+
+/**
+ * Registra o resultado do passo e escolhe a próxima taxa
+ */
+void busca_registrar(Busca_taxa *b, uint32_t perdas) {
+    if (perdas == 0) {
+        b->maior_ok = b->taxa_hz;
+    } else {
+        b->menor_falha = b->taxa_hz;
+    }
+
+    if (b->menor_falha == 0) {
+        // Ainda sem perdas: dobra até o limite do ADC
+        if (b->taxa_hz >= b->maxima) {
+            b->concluida = true;
+            return;
+        }
+        b->taxa_hz = b->taxa_hz * 2 > b->maxima ? b->maxima : b->taxa_hz * 2;
+        return;
+    }
+
+    // Bissecção até 5% de resolução
+    uint32_t intervalo = b->menor_falha - b->maior_ok;
+    if (intervalo <= b->maior_ok / 20 || intervalo <= 1) {
+        b->concluida = true;
+        return;
+    }
+    b->taxa_hz = b->maior_ok + intervalo / 2;
+}
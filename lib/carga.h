@@ -0,0 +1,38 @@
+#ifndef CARGA_H
+#define CARGA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Carga sintética para o modo de estresse
+ *
+ * O gerador produz leituras de 12 bits (hidrograma triangular com ruído,
+ * defasado por canal) que cruzam os limiares de atenção e alerta. A busca
+ * de taxa dobra a taxa até aparecerem perdas e depois bisseciona entre a
+ * maior taxa sem perdas e a menor com perdas.
+ */
+
+#define CARGA_ADC_MAX_HZ 500000     // Taxa máxima do ADC do RP2040
+
+typedef struct {
+    uint32_t passo;          // Amostras geradas
+    uint32_t semente;
+} Gerador_carga;
+
+typedef struct {
+    uint32_t taxa_hz;        // Taxa do passo atual
+    uint32_t maior_ok;       // Maior taxa sem perdas
+    uint32_t menor_falha;    // Menor taxa com perdas (0 = nenhuma ainda)
+    uint32_t maxima;
+    bool concluida;
+} Busca_taxa;
+
+void carga_init(Gerador_carga *g, uint32_t semente);
+uint16_t carga_amostra(Gerador_carga *g, uint8_t canal);
+void carga_avancar(Gerador_carga *g);
+
+void busca_iniciar(Busca_taxa *b, uint32_t inicial, uint32_t maxima);
+void busca_registrar(Busca_taxa *b, uint32_t perdas);
+
+#endif
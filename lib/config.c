@@ -0,0 +1,154 @@
+#include "config.h"
+#include <string.h>
+
+// Sons originais da estação: escala grave-aguda na atenção, bipes rápidos no alerta
+static const Padrao_buzzer som_atencao_padrao = {3, 3, 200, 0, {100, 200, 300}};
+static const Padrao_buzzer som_alerta_padrao = {1, 8, 80, 50, {2500, 0, 0}};
+
+static uint16_t ler_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static uint8_t *escrever_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+/**
+ * Configuração de fábrica: limiares cadastrados na tabela de canais
+ */
+void config_padrao(Config_estacao *c, const Tabela_canais *t, uint16_t amostragem_hz) {
+    memset(c, 0, sizeof(*c));
+    c->amostragem_hz = amostragem_hz;
+    c->n = t->n;
+    for (uint8_t i = 0; i < t->n; i++) {
+        c->limiar_atencao[i] = t->limiar_atencao[i];
+        c->limiar_alerta[i] = t->limiar_alerta[i];
+    }
+    c->som_atencao = som_atencao_padrao;
+    c->som_alerta = som_alerta_padrao;
+}
+
+static bool som_valido(const Padrao_buzzer *s) {
+    if (s->tons < 1 || s->tons > CONFIG_TONS_MAX || s->repeticoes < 1 || s->repeticoes > CONFIG_REPETICOES_MAX)
+        return false;
+    if (s->tom_ms < 10 || s->tom_ms > 1000 || s->pausa_ms > 1000)
+        return false;
+    for (uint8_t k = 0; k < s->tons; k++) {
+        if (s->freq_hz[k] < 20 || s->freq_hz[k] > 20000)
+            return false;
+    }
+    return true;
+}
+
+ResultadoConfig config_validar(const Config_estacao *c) {
+    if (c->amostragem_hz < 1 || c->amostragem_hz > CONFIG_AMOSTRAGEM_MAX_HZ || c->n > CANAIS_MAX)
+        return CONFIG_ERRO_FAIXA;
+    for (uint8_t i = 0; i < c->n; i++) {
+        if (c->limiar_atencao[i] >= c->limiar_alerta[i] || c->limiar_alerta[i] > CANAIS_ESCALA)
+            return CONFIG_ERRO_FAIXA;
+    }
+    if (!som_valido(&c->som_atencao) || !som_valido(&c->som_alerta))
+        return CONFIG_ERRO_FAIXA;
+    return CONFIG_OK;
+}
+
+/**
+ * Aplica uma lista de itens sobre c e valida o resultado
+ */
+ResultadoConfig config_aplicar_itens(Config_estacao *c, const uint8_t *itens, size_t n) {
+    size_t i = 0;
+
+    while (i < n) {
+        uint8_t tipo = itens[i++];
+        const uint8_t *p = &itens[i];
+
+        switch (tipo) {
+            case CONFIG_ITEM_AMOSTRAGEM:
+                if (n - i < 2)
+                    return CONFIG_ERRO_FORMATO;
+                c->amostragem_hz = ler_u16(p);
+                i += 2;
+                break;
+            case CONFIG_ITEM_LIMIARES:
+                if (n - i < 5)
+                    return CONFIG_ERRO_FORMATO;
+                if (p[0] >= c->n)
+                    return CONFIG_ERRO_FAIXA;
+                c->limiar_atencao[p[0]] = ler_u16(&p[1]);
+                c->limiar_alerta[p[0]] = ler_u16(&p[3]);
+                i += 5;
+                break;
+            case CONFIG_ITEM_SOM_ATENCAO:
+            case CONFIG_ITEM_SOM_ALERTA: {
+                if (n - i < 6 + 2 * CONFIG_TONS_MAX)
+                    return CONFIG_ERRO_FORMATO;
+                Padrao_buzzer *s = tipo == CONFIG_ITEM_SOM_ATENCAO ? &c->som_atencao : &c->som_alerta;
+                s->tons = p[0];
+                s->repeticoes = p[1];
+                s->tom_ms = ler_u16(&p[2]);
+                s->pausa_ms = ler_u16(&p[4]);
+                for (uint8_t k = 0; k < CONFIG_TONS_MAX; k++)
+                    s->freq_hz[k] = ler_u16(&p[6 + 2 * k]);
+                i += 6 + 2 * CONFIG_TONS_MAX;
+                break;
+            }
+            default:
+                return CONFIG_ERRO_FORMATO;
+        }
+    }
+    return config_validar(c);
+}
+
+void config_init(Config_publicada *p, const Config_estacao *inicial, uint32_t instante_us) {
+    p->blocos[0] = *inicial;
+    p->publicada_us = instante_us;
+    atomic_store_explicit(&p->ativa, &p->blocos[0], memory_order_release);
+}
+
+/**
+ * Monta a próxima versão no bloco inativo e a publica com uma troca de
+ * ponteiro. Só um escritor; a carência garante que nenhum leitor ainda
+ * use o bloco inativo.
+ */
+ResultadoConfig config_atualizar(Config_publicada *p, const uint8_t *itens, size_t n, uint32_t instante_us) {
+    if (instante_us - p->publicada_us < CONFIG_CARENCIA_US)
+        return CONFIG_OCUPADA;
+
+    const Config_estacao *atual = atomic_load_explicit(&p->ativa, memory_order_relaxed);
+    Config_estacao *nova = atual == &p->blocos[0] ? &p->blocos[1] : &p->blocos[0];
+
+    *nova = *atual;
+    ResultadoConfig r = config_aplicar_itens(nova, itens, n);
+    if (r != CONFIG_OK)
+        return r;
+
+    nova->versao = atual->versao + 1;
+    p->publicada_us = instante_us;
+    atomic_store_explicit(&p->ativa, nova, memory_order_release);
+    return CONFIG_OK;
+}
+
+uint8_t *config_item_amostragem(uint8_t *p, uint16_t hz) {
+    *p++ = CONFIG_ITEM_AMOSTRAGEM;
+    return escrever_u16(p, hz);
+}
+
+uint8_t *config_item_limiares(uint8_t *p, uint8_t canal, uint16_t atencao, uint16_t alerta) {
+    *p++ = CONFIG_ITEM_LIMIARES;
+    *p++ = canal;
+    p = escrever_u16(p, atencao);
+    return escrever_u16(p, alerta);
+}
+
+uint8_t *config_item_som(uint8_t *p, ItemConfig item, const Padrao_buzzer *som) {
+    *p++ = (uint8_t)item;
+    *p++ = som->tons;
+    *p++ = som->repeticoes;
+    p = escrever_u16(p, som->tom_ms);
+    p = escrever_u16(p, som->pausa_ms);
+    for (uint8_t k = 0; k < CONFIG_TONS_MAX; k++)
+        p = escrever_u16(p, som->freq_hz[k]);
+    return p;
+}
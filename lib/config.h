@@ -0,0 +1,90 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "canais.h"
+
+/**
+ * Configuração da estação ajustável em campo (limiares, taxa e sons)
+ *
+ * A configuração ativa é publicada por troca de ponteiro entre dois
+ * blocos: quem escreve monta a nova versão no bloco inativo e troca o
+ * ponteiro com uma escrita atômica; quem lê só carrega o ponteiro, sem
+ * travas. Um bloco só volta a ser escrito CONFIG_CARENCIA_US depois da
+ * troca, então leitores devem copiar o que usam em vez de guardar o
+ * ponteiro por mais tempo que isso.
+ *
+ * Comandos chegam como uma lista de itens (tipo(1) + campos em
+ * little-endian) aplicados juntos: ou todos entram numa nova versão, ou
+ * nenhum.
+ */
+
+#define CONFIG_TONS_MAX 3
+#define CONFIG_AMOSTRAGEM_MAX_HZ 1000   // Acima disso só o modo de estresse
+#define CONFIG_REPETICOES_MAX 20
+#define CONFIG_CARENCIA_US 1000000      // Intervalo mínimo entre publicações
+#define CONFIG_ITENS_MAX 64             // Bytes de itens por comando
+
+typedef enum {
+    CONFIG_OK = 0,
+    CONFIG_ERRO_FORMATO = 1,   // Item desconhecido ou truncado
+    CONFIG_ERRO_FAIXA = 2,     // Valor fora da faixa aceita
+    CONFIG_OCUPADA = 3,        // Publicação anterior ainda dentro da carência
+    CONFIG_ERRO_CRC = 4        // Quadro do comando corrompido
+} ResultadoConfig;
+
+typedef enum {
+    CONFIG_ITEM_AMOSTRAGEM = 1,   // hz(2)
+    CONFIG_ITEM_LIMIARES = 2,     // canal(1) atencao(2) alerta(2), em permil
+    CONFIG_ITEM_SOM_ATENCAO = 3,  // tons(1) repeticoes(1) tom_ms(2) pausa_ms(2) freq_hz(2) x CONFIG_TONS_MAX
+    CONFIG_ITEM_SOM_ALERTA = 4    // idem
+} ItemConfig;
+
+// Padrão do buzzer: os tons em sequência, seguidos da pausa, repetidos
+typedef struct {
+    uint8_t tons;
+    uint8_t repeticoes;
+    uint16_t tom_ms;
+    uint16_t pausa_ms;
+    uint16_t freq_hz[CONFIG_TONS_MAX];
+} Padrao_buzzer;
+
+typedef struct {
+    uint32_t versao;                     // Incrementa a cada publicação
+    uint16_t amostragem_hz;
+    uint8_t n;                           // Canais com limiares
+    uint16_t limiar_atencao[CANAIS_MAX];
+    uint16_t limiar_alerta[CANAIS_MAX];
+    Padrao_buzzer som_atencao;
+    Padrao_buzzer som_alerta;
+} Config_estacao;
+
+typedef struct {
+    Config_estacao blocos[2];
+    _Atomic(Config_estacao *) ativa;
+    uint32_t publicada_us;               // Instante da última troca
+} Config_publicada;
+
+void config_padrao(Config_estacao *c, const Tabela_canais *t, uint16_t amostragem_hz);
+ResultadoConfig config_validar(const Config_estacao *c);
+ResultadoConfig config_aplicar_itens(Config_estacao *c, const uint8_t *itens, size_t n);
+
+void config_init(Config_publicada *p, const Config_estacao *inicial, uint32_t instante_us);
+ResultadoConfig config_atualizar(Config_publicada *p, const uint8_t *itens, size_t n, uint32_t instante_us);
+
+// Itens de comando (usados pelas ferramentas de host)
+uint8_t *config_item_amostragem(uint8_t *p, uint16_t hz);
+uint8_t *config_item_limiares(uint8_t *p, uint8_t canal, uint16_t atencao, uint16_t alerta);
+uint8_t *config_item_som(uint8_t *p, ItemConfig item, const Padrao_buzzer *som);
+
+/**
+ * Configuração ativa; uma carga atômica, sem travas
+ */
+static inline const Config_estacao *config_atual(Config_publicada *p) {
+    return atomic_load_explicit(&p->ativa, memory_order_acquire);
+}
+
+#endif
@@ -0,0 +1,56 @@
+#include "cores.h"
+#include "ram.h"
+
+// Gama 2.6: gama[i] = round((i / 255)^2.6 * 255)
+static const uint8_t gama[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+      3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+      7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+     13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+     20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+     30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+     42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+     76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+     97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+    122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+    150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+    182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+    218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255,
+};
+
+// gama seguido do brilho global; refeita só quando o brilho muda
+static uint8_t saida[256];
+static uint8_t brilho_atual;
+
+/**
+ * Define o brilho global (0-255). O brilho é aplicado depois da gama,
+ * então a corrente da matriz cai proporcionalmente a ele.
+ */
+void cores_definir_brilho(uint8_t brilho) {
+    for (int i = 0; i < 256; i++)
+        saida[i] = (uint8_t)((gama[i] * brilho + 127) / 255);
+    brilho_atual = brilho;
+}
+
+uint8_t cores_brilho(void) {
+    return brilho_atual;
+}
+
+/**
+ * Converte uma cor para a palavra enviada ao PIO: G, R, B nos bits 31..8
+ */
+uint32_t NA_RAM(cores_palavra)(Cor_rgb cor) {
+    return ((uint32_t)saida[cor.g] << 24) | ((uint32_t)saida[cor.r] << 16) | ((uint32_t)saida[cor.b] << 8);
+}
+
+/**
+ * Monta um quadro inteiro: pixels com máscara != 0 recebem a cor, os demais ficam apagados
+ */
+void NA_RAM(cores_empacotar)(const uint8_t *mascara, Cor_rgb cor, uint32_t *palavras, uint8_t n) {
+    uint32_t acesa = cores_palavra(cor);
+    for (uint8_t i = 0; i < n; i++)
+        palavras[i] = mascara[i] ? acesa : 0;
+}
@@ -0,0 +1,23 @@
+#ifndef CORES_H
+#define CORES_H
+
+#include <stdint.h>
+
+/**
+ * Pipeline de cor da matriz WS2812
+ *
+ * RGB 8 bits -> gama (tabela) -> brilho global (tabela) -> palavra GRB
+ * alinhada à esquerda, no formato que o programa PIO envia (autopull de
+ * 24 bits, deslocando a partir do bit 31). Só usa inteiros.
+ */
+
+typedef struct {
+    uint8_t r, g, b;
+} Cor_rgb;
+
+void cores_definir_brilho(uint8_t brilho);
+uint8_t cores_brilho(void);
+uint32_t cores_palavra(Cor_rgb cor);
+void cores_empacotar(const uint8_t *mascara, Cor_rgb cor, uint32_t *palavras, uint8_t n);
+
+#endif
@@ -0,0 +1,64 @@
+#include "entrega.h"
+
+/**
+ * Cria a fila da entrega; ENTREGA_MAIS_RECENTE sempre usa 1 posição
+ */
+bool entrega_criar(Entrega *e, const char *nome, PoliticaEntrega politica,
+                   UBaseType_t tamanho, UBaseType_t tamanho_item) {
+    e->nome = nome;
+    e->politica = politica;
+    e->enviados = 0;
+    e->descartados = 0;
+    e->sobrescritos = 0;
+    e->descarte = NULL;
+
+    if (politica == ENTREGA_MAIS_RECENTE)
+        tamanho = 1;
+    if (politica == ENTREGA_SOBRESCREVER) {
+        e->descarte = pvPortMalloc(tamanho_item);
+        if (e->descarte == NULL)
+            return false;
+    }
+
+    e->fila = xQueueCreate(tamanho, tamanho_item);
+    return e->fila != NULL;
+}
+
+/**
+ * Envia sem bloquear; retorna false se o item novo foi descartado
+ */
+bool entrega_enviar(Entrega *e, const void *item) {
+    switch (e->politica) {
+        case ENTREGA_MAIS_RECENTE:
+            if (uxQueueMessagesWaiting(e->fila) > 0)
+                e->sobrescritos++;
+            xQueueOverwrite(e->fila, item);
+            break;
+
+        case ENTREGA_SOBRESCREVER:
+            while (xQueueSend(e->fila, item, 0) != pdTRUE) {
+                // Se o consumidor esvaziou a fila nesse meio tempo, só tenta de novo
+                if (xQueueReceive(e->fila, e->descarte, 0) == pdTRUE)
+                    e->sobrescritos++;
+            }
+            break;
+
+        case ENTREGA_DESCARTAR:
+        default:
+            if (xQueueSend(e->fila, item, 0) != pdTRUE) {
+                e->descartados++;
+                return false;
+            }
+            break;
+    }
+    e->enviados++;
+    return true;
+}
+
+bool entrega_receber(Entrega *e, void *item, TickType_t espera) {
+    return xQueueReceive(e->fila, item, espera) == pdTRUE;
+}
+
+uint32_t entrega_perdas(const Entrega *e) {
+    return e->descartados + (e->politica == ENTREGA_SOBRESCREVER ? e->sobrescritos : 0);
+}
@@ -0,0 +1,40 @@
+#ifndef ENTREGA_H
+#define ENTREGA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "queue.h"
+
+/**
+ * Entrega de amostras entre tasks com política explícita para fila cheia
+ *
+ * Toda passagem de dados entre tasks usa uma Entrega, que conta o que foi
+ * enviado, descartado ou sobrescrito. Só descartes e sobrescritas de
+ * ENTREGA_SOBRESCREVER são perdas; em ENTREGA_MAIS_RECENTE sobrescrever a
+ * amostra velha é o comportamento esperado.
+ */
+
+typedef enum {
+    ENTREGA_DESCARTAR,      // Fila cheia: a amostra nova é descartada
+    ENTREGA_SOBRESCREVER,   // Fila cheia: a mais antiga sai para a nova entrar
+    ENTREGA_MAIS_RECENTE    // Caixa de 1 posição: o consumidor só vê a última
+} PoliticaEntrega;
+
+typedef struct {
+    const char *nome;
+    QueueHandle_t fila;
+    PoliticaEntrega politica;
+    void *descarte;                 // Área para retirar o item mais antigo
+    volatile uint32_t enviados;
+    volatile uint32_t descartados;
+    volatile uint32_t sobrescritos;
+} Entrega;
+
+bool entrega_criar(Entrega *e, const char *nome, PoliticaEntrega politica,
+                   UBaseType_t tamanho, UBaseType_t tamanho_item);
+bool entrega_enviar(Entrega *e, const void *item);
+bool entrega_receber(Entrega *e, void *item, TickType_t espera);
+uint32_t entrega_perdas(const Entrega *e);
+
+#endif
@@ -0,0 +1,126 @@
+#include "filtro.h"
+#include "ram.h"
+
+#if FILTRO_JANELA != 3 && FILTRO_JANELA != 5 && FILTRO_JANELA != 7
+#error "FILTRO_JANELA deve ser 3, 5 ou 7"
+#endif
+
+// Menor/maior sem desvio: d >> 31 vale -1 quando a < b
+static inline int32_t menor(int32_t a, int32_t b) {
+    int32_t d = a - b;
+    return b + (d & (d >> 31));
+}
+
+static inline int32_t maior(int32_t a, int32_t b) {
+    int32_t d = a - b;
+    return a - (d & (d >> 31));
+}
+
+// Troca de comparação da rede: v[i] <= v[j] ao final
+#define TROCA(v, i, j) do { \
+    int32_t a_ = (v)[i], b_ = (v)[j]; \
+    (v)[i] = menor(a_, b_); \
+    (v)[j] = maior(a_, b_); \
+} while (0)
+
+/**
+ * Ordena FILTRO_JANELA valores com a rede de ordenação do tamanho
+ */
+static void NA_RAM(ordenar)(int32_t *v) {
+#if FILTRO_JANELA == 3
+    TROCA(v, 0, 1); TROCA(v, 1, 2); TROCA(v, 0, 1);
+#elif FILTRO_JANELA == 5
+    TROCA(v, 0, 1); TROCA(v, 3, 4); TROCA(v, 2, 4);
+    TROCA(v, 2, 3); TROCA(v, 1, 4); TROCA(v, 0, 3);
+    TROCA(v, 0, 2); TROCA(v, 1, 3); TROCA(v, 1, 2);
+#else
+    TROCA(v, 0, 6); TROCA(v, 2, 3); TROCA(v, 4, 5); TROCA(v, 0, 2);
+    TROCA(v, 1, 4); TROCA(v, 3, 6); TROCA(v, 0, 1); TROCA(v, 2, 5);
+    TROCA(v, 3, 4); TROCA(v, 1, 2); TROCA(v, 4, 6); TROCA(v, 2, 3);
+    TROCA(v, 4, 5); TROCA(v, 1, 2); TROCA(v, 3, 4); TROCA(v, 5, 6);
+#endif
+}
+
+uint16_t filtro_mediana(const uint16_t *janela) {
+    int32_t v[FILTRO_JANELA];
+    for (uint8_t i = 0; i < FILTRO_JANELA; i++)
+        v[i] = janela[i];
+    ordenar(v);
+    return (uint16_t)v[FILTRO_JANELA / 2];
+}
+
+void filtro_init(Filtro *f) {
+    f->pos = 0;
+    f->iniciado = 0;
+    for (uint8_t c = 0; c < CANAIS_MAX; c++) {
+        f->modo[c] = FILTRO_NENHUM;
+        f->passo_max[c] = 0;
+        f->saida[c] = 0;
+        f->rejeitados[c] = 0;
+    }
+}
+
+void filtro_configurar(Filtro *f, uint8_t canal, ModoFiltro modo, uint16_t passo_max) {
+    f->modo[canal] = modo;
+    f->passo_max[canal] = passo_max;
+}
+
+/**
+ * Filtra as leituras brutas no lugar; a primeira amostra preenche a janela
+ */
+void NA_RAM(filtro_aplicar)(Filtro *f, uint16_t *bruto, uint8_t n) {
+    if (!f->iniciado) {
+        for (uint8_t c = 0; c < n; c++) {
+            for (uint8_t i = 0; i < FILTRO_JANELA; i++)
+                f->janela[c][i] = bruto[c];
+            f->saida[c] = bruto[c];
+        }
+        f->iniciado = 1;
+    }
+
+    for (uint8_t c = 0; c < n; c++) {
+        int32_t x = bruto[c];
+        f->janela[c][f->pos] = (uint16_t)x;
+        if (f->modo[c] == FILTRO_NENHUM && f->passo_max[c] == 0) {
+            f->saida[c] = (uint16_t)x;
+            continue;
+        }
+
+        int32_t y = x;
+        if (f->modo[c] != FILTRO_NENHUM) {
+            int32_t v[FILTRO_JANELA];
+            for (uint8_t i = 0; i < FILTRO_JANELA; i++)
+                v[i] = f->janela[c][i];
+            ordenar(v);
+            int32_t med = v[FILTRO_JANELA / 2];
+
+            if (f->modo[c] == FILTRO_MEDIANA) {
+                y = med;
+            } else {
+                // MAD: mediana dos desvios absolutos em relação à mediana
+                for (uint8_t i = 0; i < FILTRO_JANELA; i++) {
+                    int32_t d = v[i] - med;
+                    v[i] = maior(d, -d);
+                }
+                ordenar(v);
+                int32_t limiar = maior((v[FILTRO_JANELA / 2] * FILTRO_HAMPEL_K_Q8) >> 8, FILTRO_HAMPEL_PISO);
+                int32_t d = x - med;
+
+                // pico = -1 quando |x - med| > limiar
+                int32_t pico = (limiar - maior(d, -d)) >> 31;
+                y = (x & ~pico) | (med & pico);
+                f->rejeitados[c] -= pico;
+            }
+        }
+
+        // Limite de taxa: desvio em relação à saída anterior saturado em +-passo_max
+        int32_t passo = f->passo_max[c] ? f->passo_max[c] : UINT16_MAX;
+        int32_t anterior = f->saida[c];
+        y = anterior + maior(menor(y - anterior, passo), -passo);
+
+        f->saida[c] = (uint16_t)y;
+        bruto[c] = (uint16_t)y;
+    }
+
+    f->pos = f->pos + 1 < FILTRO_JANELA ? f->pos + 1 : 0;
+}
@@ -0,0 +1,47 @@
+#ifndef FILTRO_H
+#define FILTRO_H
+
+#include <stdint.h>
+#include "canais.h"
+
+/**
+ * Filtro de picos entre a aquisição e a classificação dos canais
+ *
+ * Cada canal guarda as últimas FILTRO_JANELA leituras brutas. A mediana
+ * sai de uma rede de ordenação (só trocas sem desvio, inteiras) e serve
+ * tanto para a saída de mediana quanto para o Hampel, que troca a leitura
+ * atual pela mediana quando ela se afasta mais que k * 1,4826 * MAD. Um
+ * limite de taxa opcional segura a variação por amostra.
+ *
+ * Um degrau real passa depois de (FILTRO_JANELA + 1) / 2 amostras.
+ */
+
+#ifndef FILTRO_JANELA
+#define FILTRO_JANELA 5            // 3, 5 ou 7 (redes de ordenação disponíveis)
+#endif
+
+#define FILTRO_HAMPEL_K_Q8 1139    // 3 * 1,4826 em Q8
+#define FILTRO_HAMPEL_PISO 64      // Desvio mínimo para rejeitar (contagens): acima do ruído do ADC
+
+typedef enum {
+    FILTRO_NENHUM,
+    FILTRO_MEDIANA,                // Saída = mediana da janela
+    FILTRO_HAMPEL                  // Saída = leitura, ou a mediana se for pico
+} ModoFiltro;
+
+typedef struct {
+    uint16_t janela[CANAIS_MAX][FILTRO_JANELA];
+    uint8_t pos;                   // Próxima posição (a mesma para todos os canais)
+    uint8_t iniciado;
+    uint8_t modo[CANAIS_MAX];
+    uint16_t passo_max[CANAIS_MAX]; // Variação máxima por amostra; 0 = sem limite
+    uint16_t saida[CANAIS_MAX];     // Última saída, base do limite de taxa
+    uint32_t rejeitados[CANAIS_MAX]; // Leituras trocadas pelo Hampel
+} Filtro;
+
+void filtro_init(Filtro *f);
+void filtro_configurar(Filtro *f, uint8_t canal, ModoFiltro modo, uint16_t passo_max);
+void filtro_aplicar(Filtro *f, uint16_t *bruto, uint8_t n);
+uint16_t filtro_mediana(const uint16_t *janela);
+
+#endif
@@ -0,0 +1,111 @@
+#include "historico.h"
+#include "ram.h"
+#include <stddef.h>
+
+const uint8_t hist_fator[HIST_NIVEIS] = {1, 60, 10};
+const char *const hist_janela[HIST_NIVEIS] = {"2min", "2h", "21h"};
+
+static void nivel_abrir(Nivel_historico *nv) {
+    for (uint8_t c = 0; c < HIST_CANAIS; c++) {
+        nv->min[c] = UINT16_MAX;
+        nv->max[c] = 0;
+        nv->soma[c] = 0;
+    }
+    nv->n = 0;
+    nv->filhos = 0;
+}
+
+void historico_init(Historico *h, uint8_t canais) {
+    h->canais = canais < HIST_CANAIS ? canais : HIST_CANAIS;
+    h->iniciado = false;
+    for (uint8_t k = 0; k < HIST_NIVEIS; k++) {
+        atomic_store_explicit(&h->niveis[k].seq, 0, memory_order_relaxed);
+        h->niveis[k].cabeca = 0;
+        h->niveis[k].cheios = 0;
+        nivel_abrir(&h->niveis[k]);
+    }
+}
+
+/**
+ * Fecha o balde aberto do nível k e o dobra no nível seguinte; quando o
+ * nível seguinte completa seus filhos, fecha em cascata
+ */
+static void NA_RAM(historico_fechar)(Historico *h, uint8_t k) {
+    Nivel_historico *nv = &h->niveis[k];
+    Nivel_historico *pai = k + 1 < HIST_NIVEIS ? &h->niveis[k + 1] : NULL;
+
+    uint32_t seq = atomic_load_explicit(&nv->seq, memory_order_relaxed);
+    atomic_store_explicit(&nv->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (uint8_t c = 0; c < h->canais; c++) {
+        Balde *b = &nv->baldes[c][nv->cabeca];
+        b->min = nv->min[c];
+        b->max = nv->max[c];
+        b->media = nv->n ? (uint16_t)(nv->soma[c] / nv->n) : 0;
+
+        // Pai recebe a média de cada filho, então cada balde pesa pelo tempo
+        if (pai != NULL && nv->n > 0) {
+            pai->min[c] = b->min < pai->min[c] ? b->min : pai->min[c];
+            pai->max[c] = b->max > pai->max[c] ? b->max : pai->max[c];
+            pai->soma[c] += b->media;
+        }
+    }
+
+    nv->cabeca = (nv->cabeca + 1) % HIST_COLUNAS;
+    if (nv->cheios < HIST_COLUNAS)
+        nv->cheios++;
+    atomic_store_explicit(&nv->seq, seq + 2, memory_order_release);
+
+    if (pai != NULL) {
+        pai->n += nv->n > 0;
+        if (++pai->filhos >= hist_fator[k + 1])
+            historico_fechar(h, k + 1);
+    }
+    nivel_abrir(nv);
+}
+
+/**
+ * Acrescenta uma amostra (permil) ao balde aberto do nível 0. Segundos
+ * sem amostras viram baldes vazios, então o custo é O(1) por amostra
+ * mais um fechamento por segundo decorrido.
+ */
+void NA_RAM(historico_amostra)(Historico *h, uint32_t instante_us, const uint16_t *valor) {
+    if (!h->iniciado) {
+        h->inicio_balde_us = instante_us;
+        h->iniciado = true;
+    }
+    while (instante_us - h->inicio_balde_us >= HIST_BALDE_US) {
+        historico_fechar(h, 0);
+        h->inicio_balde_us += HIST_BALDE_US;
+    }
+
+    Nivel_historico *nv = &h->niveis[0];
+    for (uint8_t c = 0; c < h->canais; c++) {
+        uint16_t v = valor[c];
+        nv->min[c] = v < nv->min[c] ? v : nv->min[c];
+        nv->max[c] = v > nv->max[c] ? v : nv->max[c];
+        nv->soma[c] += v;
+    }
+    nv->n++;
+}
+
+/**
+ * Copia o balde da coluna (0 = mais antiga, HIST_COLUNAS - 1 = último
+ * balde fechado); false se o anel ainda não chegou nessa coluna. Repete a
+ * cópia se a aquisição fechou um balde do nível no meio dela.
+ */
+bool historico_balde(const Historico *h, uint8_t nivel, uint8_t canal, uint8_t coluna, Balde *copia) {
+    const Nivel_historico *nv = &h->niveis[nivel];
+    uint32_t seq;
+    bool valido;
+
+    do {
+        seq = atomic_load_explicit(&nv->seq, memory_order_acquire);
+        valido = HIST_COLUNAS - 1 - coluna < nv->cheios;
+        if (valido)
+            *copia = nv->baldes[canal][(nv->cabeca + coluna) % HIST_COLUNAS];
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || atomic_load_explicit(&nv->seq, memory_order_relaxed) != seq);
+    return valido;
+}
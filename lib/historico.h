@@ -0,0 +1,70 @@
+#ifndef HISTORICO_H
+#define HISTORICO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "canais.h"
+
+/**
+ * Histórico de tendência dos canais em várias resoluções
+ *
+ * Cada nível é um anel de HIST_COLUNAS baldes (um por coluna do display)
+ * com mínimo, máximo e média. O nível 0 acumula amostras em baldes de 1 s;
+ * ao fechar, cada balde é dobrado no balde aberto do nível seguinte
+ * (60 s, depois 10 min). Cada amostra custa O(1) e a memória é fixa.
+ *
+ * Uma task escreve (historico_amostra) e outra lê (historico_balde): cada
+ * nível tem um contador de sequência, ímpar durante o fechamento de um
+ * balde, e a leitura copia o balde e repete se o contador mudou.
+ */
+
+#ifndef HIST_CANAIS
+#define HIST_CANAIS 2          // Canais guardados (os primeiros da tabela)
+#endif
+#define HIST_COLUNAS 128       // Baldes por nível (largura do display)
+#define HIST_NIVEIS 3
+#define HIST_BALDE_US 1000000  // Duração do balde do nível 0
+
+// Baldes do nível anterior que formam um balde de cada nível (1 s, 1 min, 10 min)
+extern const uint8_t hist_fator[HIST_NIVEIS];
+// Janela coberta pelas HIST_COLUNAS de cada nível, para o título do gráfico
+extern const char *const hist_janela[HIST_NIVEIS];
+
+// Balde fechado; min > max indica período sem amostras
+typedef struct {
+    uint16_t min;
+    uint16_t max;
+    uint16_t media;
+} Balde;
+
+typedef struct {
+    Balde baldes[HIST_CANAIS][HIST_COLUNAS];
+    atomic_uint_fast32_t seq;        // Ímpar enquanto baldes, cabeca e cheios mudam
+    uint8_t cabeca;                  // Próximo balde a escrever
+    uint8_t cheios;                  // Baldes válidos no anel
+
+    // Balde aberto
+    uint16_t min[HIST_CANAIS];
+    uint16_t max[HIST_CANAIS];
+    uint32_t soma[HIST_CANAIS];      // Nível 0: amostras; demais: médias dos baldes filhos
+    uint32_t n;
+    uint8_t filhos;                  // Baldes do nível anterior já dobrados
+} Nivel_historico;
+
+typedef struct {
+    Nivel_historico niveis[HIST_NIVEIS];
+    uint8_t canais;
+    uint32_t inicio_balde_us;        // Início do balde aberto do nível 0
+    bool iniciado;
+} Historico;
+
+void historico_init(Historico *h, uint8_t canais);
+void historico_amostra(Historico *h, uint32_t instante_us, const uint16_t *valor);
+bool historico_balde(const Historico *h, uint8_t nivel, uint8_t canal, uint8_t coluna, Balde *copia);
+
+static inline bool historico_balde_vazio(const Balde *b) {
+    return b->min > b->max;
+}
+
+#endif
@@ -0,0 +1,226 @@
+#include "painel.h"
+#include "ram.h"
+#include <stdio.h>
+#include <string.h>
+
+const Layout_coluna layout_colunas[CANAIS_POR_TELA] = {
+    {0, 40, 10},
+    {64, 102, 75}
+};
+
+#define PAINEL_METADE (WIDTH / CANAIS_POR_TELA)   // Colunas de cada coluna do painel
+
+#if (PAINEL_TEXTO_Y & 7) == 0
+#error "PAINEL_TEXTO_Y deve cruzar duas páginas (ver painel_valor)"
+#endif
+
+/**
+ * Segmentos acesos: percentual arredondado para a dezena mais próxima
+ */
+uint8_t NA_RAM(painel_segmentos)(uint16_t valor) {
+    return (valor / 10 + 4) / 10;
+}
+
+/**
+ * Desenha uma barra de 10 segmentos preenchida conforme o valor (permil)
+ */
+void painel_barra(ssd1306_t *ssd, uint8_t x, uint16_t valor) {
+    uint8_t acesos = painel_segmentos(valor);
+
+    for (uint8_t s = 0; s < BARRA_SEGMENTOS; s++) {
+        uint8_t topo = BARRA_TOPO + (BARRA_SEGMENTOS - 1 - s) * BARRA_ALTURA_SEG;
+        ssd1306_rect(ssd, topo, x, BARRA_LARGURA, BARRA_ALTURA_SEG, true, s < acesos);
+    }
+}
+
+// ================= VERSÃO RUNTIME =================
+
+void painel_dashboard_runtime(ssd1306_t *ssd, const Tabela_canais *t, const Dados_analogicos *d, uint8_t primeiro) {
+    ssd1306_fill(ssd, false); // Limpa a tela
+
+    for (uint8_t c = 0; c < CANAIS_POR_TELA && primeiro + c < d->n; c++) {
+        uint8_t i = primeiro + c;
+        const Layout_coluna *l = &layout_colunas[c];
+        char str_valor[10];
+        sprintf(str_valor, "%u", d->valor[i] / 10); // Percentual sem decimais
+
+        // Exibe título, valor e barra do canal
+        ssd1306_draw_string(ssd, t->rotulo[i], l->rotulo_x, PAINEL_TEXTO_Y);
+        ssd1306_draw_string(ssd, str_valor, l->valor_x, PAINEL_TEXTO_Y);
+        painel_barra(ssd, l->barra_x, d->valor[i]);
+    }
+}
+
+void painel_alerta_runtime(ssd1306_t *ssd, const char *linha1, const char *linha2) {
+    ssd1306_fill(ssd, false);
+    ssd1306_draw_string(ssd, "ALERTA", 40, linha2 ? 10 : 20);
+    ssd1306_draw_string(ssd, linha1, 15, linha2 ? 20 : 30);
+
+    if (linha2 != NULL) {
+        ssd1306_draw_string(ssd, "ALERTA", 40, 40);
+        ssd1306_draw_string(ssd, linha2, 15, 50);
+    }
+}
+
+/**
+ * Linha do gráfico para um valor em permil
+ */
+static uint8_t painel_grafico_y(uint16_t valor) {
+    return GRAFICO_BASE - (uint8_t)((uint32_t)valor * (GRAFICO_BASE - GRAFICO_TOPO) / CANAIS_ESCALA);
+}
+
+static void painel_grafico_titulo(ssd1306_t *ssd, const Tabela_canais *t, uint8_t nivel, uint8_t canal) {
+    char titulo[17];
+    snprintf(titulo, sizeof(titulo), "%s %s", t->rotulo[canal], hist_janela[nivel]);
+    ssd1306_draw_string(ssd, titulo, 0, 0);
+}
+
+void painel_grafico_runtime(ssd1306_t *ssd, const Tabela_canais *t, const Historico *h, uint8_t nivel, uint8_t canal) {
+    ssd1306_fill(ssd, false);
+    painel_grafico_titulo(ssd, t, nivel, canal);
+
+    for (uint8_t x = 0; x < WIDTH; x += GRAFICO_TRACO) {
+        ssd1306_pixel(ssd, x, painel_grafico_y(t->limiar_atencao[canal]), true);
+        ssd1306_pixel(ssd, x, painel_grafico_y(t->limiar_alerta[canal]), true);
+    }
+
+    for (uint8_t x = 0; x < HIST_COLUNAS; x++) {
+        Balde b;
+        if (!historico_balde(h, nivel, canal, x, &b) || historico_balde_vazio(&b))
+            continue;
+        uint8_t topo = painel_grafico_y(b.max), base = painel_grafico_y(b.min);
+        ssd1306_line(ssd, x, topo, x, base, true);
+        if (base - topo >= 2)
+            ssd1306_pixel(ssd, x, painel_grafico_y(b.media), false);
+    }
+}
+
+// ================= VERSÃO PRÉ-RENDERIZADA =================
+
+// O gerador dos assets compila só a versão runtime
+#ifndef PAINEL_GERADOR
+#include "painel_assets.h"
+
+/**
+ * Escreve o percentual com os dígitos pré-deslocados para PAINEL_TEXTO_Y,
+ * substituindo as 8 linhas da célula como faz ssd1306_draw_char
+ */
+static void NA_RAM(painel_valor)(ssd1306_t *ssd, uint8_t x, uint8_t percentual) {
+    const uint8_t m0 = (uint8_t)(0xFF << (PAINEL_TEXTO_Y & 7));
+    const uint8_t m1 = (uint8_t)~(0xFF << (PAINEL_TEXTO_Y & 7));
+    uint8_t digitos[3], n = 0;
+
+    do {
+        digitos[n++] = percentual % 10;
+        percentual /= 10;
+    } while (percentual > 0);
+
+    while (n > 0) {
+        const uint8_t *g = PAINEL_DIGITOS[digitos[--n]];
+        uint8_t *col = &ssd->ram_buffer[1 + (x << 3) + (PAINEL_TEXTO_Y >> 3)];
+        for (uint8_t k = 0; k < 8; k++, col += 8) {
+            col[0] = (col[0] & ~m0) | g[2 * k];
+            col[1] = (col[1] & ~m1) | g[2 * k + 1];
+        }
+        x += 8;
+    }
+}
+
+void NA_RAM(painel_dashboard)(ssd1306_t *ssd, const Tabela_canais *t, const Dados_analogicos *d, uint8_t primeiro) {
+    // Confere se o texto da tela é o que foi pré-renderizado
+    for (uint8_t c = 0; c < CANAIS_POR_TELA && primeiro + c < d->n; c++) {
+        if (strcmp(t->rotulo[primeiro + c], PAINEL_ROTULOS[c]) != 0) {
+            painel_dashboard_runtime(ssd, t, d, primeiro);
+            return;
+        }
+    }
+
+    for (uint8_t c = 0; c < CANAIS_POR_TELA; c++) {
+        uint8_t *metade = &ssd->ram_buffer[1 + c * PAINEL_METADE * 8];
+
+        if (primeiro + c >= d->n) {
+            memset(metade, 0, PAINEL_METADE * 8);
+            continue;
+        }
+
+        uint8_t i = primeiro + c;
+        const Layout_coluna *l = &layout_colunas[c];
+        memcpy(metade, PAINEL_FUNDO[c], PAINEL_METADE * 8);
+        memcpy(&ssd->ram_buffer[1 + (l->barra_x << 3)], PAINEL_BARRAS[c][painel_segmentos(d->valor[i])], BARRA_LARGURA * 8);
+        painel_valor(ssd, l->valor_x, d->valor[i] / 10);
+    }
+}
+
+void NA_RAM(painel_alerta)(ssd1306_t *ssd, const char *linha1, const char *linha2) {
+    const uint8_t *tela = NULL;
+
+    if (linha2 == NULL) {
+        for (uint8_t k = 0; k < CANAIS_POR_TELA; k++) {
+            if (strcmp(linha1, PAINEL_MENSAGENS[k]) == 0)
+                tela = PAINEL_ALERTA_UM[k];
+        }
+    } else if (strcmp(linha1, PAINEL_MENSAGENS[0]) == 0 && strcmp(linha2, PAINEL_MENSAGENS[1]) == 0) {
+        tela = PAINEL_ALERTA_DOIS;
+    }
+
+    if (tela == NULL) {
+        painel_alerta_runtime(ssd, linha1, linha2);
+        return;
+    }
+    memcpy(&ssd->ram_buffer[1], tela, WIDTH * HEIGHT / 8);
+}
+
+#endif
+
+// ================= GRÁFICO DE HISTÓRICO =================
+
+/**
+ * Liga as linhas y0..y1 (y0 <= y1) da coluna x: bytes inteiros nas
+ * páginas do meio e máscaras só nas pontas
+ */
+void NA_RAM(painel_span)(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1) {
+    uint8_t *col = &ssd->ram_buffer[1 + (x << 3)];
+    uint8_t p0 = y0 >> 3, p1 = y1 >> 3;
+    uint8_t m0 = (uint8_t)(0xFF << (y0 & 7));
+    uint8_t m1 = (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+    if (p0 == p1) {
+        col[p0] |= m0 & m1;
+        return;
+    }
+    col[p0] |= m0;
+    for (uint8_t p = p0 + 1; p < p1; p++)
+        col[p] = 0xFF;
+    col[p1] |= m1;
+}
+
+/**
+ * Envelope mínimo/máximo das HIST_COLUNAS do nível, com a média apagada
+ * dentro do envelope e os limiares do canal tracejados
+ */
+void NA_RAM(painel_grafico)(ssd1306_t *ssd, const Tabela_canais *t, const Historico *h, uint8_t nivel, uint8_t canal) {
+    memset(&ssd->ram_buffer[1], 0, ssd->bufsize - 1);
+    painel_grafico_titulo(ssd, t, nivel, canal);
+
+    const uint8_t limiares[2] = {
+        painel_grafico_y(t->limiar_atencao[canal]), painel_grafico_y(t->limiar_alerta[canal])
+    };
+    for (uint8_t k = 0; k < 2; k++) {
+        uint8_t *col = &ssd->ram_buffer[1 + (limiares[k] >> 3)];
+        uint8_t bit = (uint8_t)(1 << (limiares[k] & 7));
+        for (uint8_t x = 0; x < WIDTH; x += GRAFICO_TRACO)
+            col[x << 3] |= bit;
+    }
+
+    for (uint8_t x = 0; x < HIST_COLUNAS; x++) {
+        Balde b;
+        if (!historico_balde(h, nivel, canal, x, &b) || historico_balde_vazio(&b))
+            continue;
+        uint8_t topo = painel_grafico_y(b.max), base = painel_grafico_y(b.min);
+        painel_span(ssd, x, topo, base);
+        if (base - topo >= 2) {
+            uint8_t y = painel_grafico_y(b.media);
+            ssd->ram_buffer[1 + (x << 3) + (y >> 3)] &= (uint8_t)~(1 << (y & 7));
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef PAINEL_H
+#define PAINEL_H
+
+#include "ssd1306.h"
+#include "canais.h"
+#include "historico.h"
+
+/**
+ * Telas do display: painel de barras dos canais e telas de alerta
+ *
+ * Cada tela tem duas versões: a "runtime", que desenha com as primitivas
+ * do ssd1306, e a rápida, que copia os elementos estáticos pré-renderizados
+ * em painel_assets.h (gerado por tools/gera_assets). A versão rápida recai
+ * na runtime quando o texto da tela não foi pré-renderizado. O gráfico de
+ * histórico não tem assets: a versão rápida escreve os envelopes em
+ * trechos verticais de bytes inteiros, sem ssd1306_line por ponto.
+ */
+
+#define CANAIS_POR_TELA 2     // Colunas de barras por tela do painel
+#define BARRA_SEGMENTOS 10    // Segmentos de 10% por barra
+#define BARRA_TOPO 14         // Linha do segmento de 100%
+#define BARRA_LARGURA 30
+#define BARRA_ALTURA_SEG 5
+#define PAINEL_TEXTO_Y 3      // Linha dos rótulos e valores
+#define GRAFICO_TOPO 10       // Linha de 100% do gráfico de histórico
+#define GRAFICO_BASE 63       // Linha de 0%
+#define GRAFICO_TRACO 4       // Passo do tracejado dos limiares
+
+// Posição do rótulo, do valor e da barra de cada coluna do painel
+typedef struct {
+    uint8_t rotulo_x;
+    uint8_t valor_x;
+    uint8_t barra_x;
+} Layout_coluna;
+
+extern const Layout_coluna layout_colunas[CANAIS_POR_TELA];
+
+uint8_t painel_segmentos(uint16_t valor);
+void painel_barra(ssd1306_t *ssd, uint8_t x, uint16_t valor);
+
+void painel_dashboard(ssd1306_t *ssd, const Tabela_canais *t, const Dados_analogicos *d, uint8_t primeiro);
+void painel_dashboard_runtime(ssd1306_t *ssd, const Tabela_canais *t, const Dados_analogicos *d, uint8_t primeiro);
+void painel_alerta(ssd1306_t *ssd, const char *linha1, const char *linha2);
+void painel_alerta_runtime(ssd1306_t *ssd, const char *linha1, const char *linha2);
+void painel_span(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1);
+void painel_grafico(ssd1306_t *ssd, const Tabela_canais *t, const Historico *h, uint8_t nivel, uint8_t canal);
+void painel_grafico_runtime(ssd1306_t *ssd, const Tabela_canais *t, const Historico *h, uint8_t nivel, uint8_t canal);
+
+#endif
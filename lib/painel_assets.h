@@ -0,0 +1,700 @@
+// Gerado por tools/gera_assets.c - não editar (make -C tools assets)
+#ifndef PAINEL_ASSETS_H
+#define PAINEL_ASSETS_H
+
+#include <stdint.h>
+
+static const char *const PAINEL_ROTULOS[2] = {"CHUVA", "NIVEL"};
+static const char *const PAINEL_MENSAGENS[2] = {"CHUVA INTENSA", "NIVEL ELEVADO"};
+
+// Colunas x = 64*c .. 64*c+63, com o rótulo do canal
+static const uint8_t PAINEL_FUNDO[2][512] = {
+  {
+    0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+// Colunas da barra (x = barra_x..barra_x+29) para 0..10 segmentos
+static const uint8_t PAINEL_BARRAS[2][11][240] = {
+  {
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x40, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x40, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x98, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xE0, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+  },
+  {
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0xFC, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xE3, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xF8, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xC6, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0x31, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x48, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x48, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0x43, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x42, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x48, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x08, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xF8, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+  },
+};
+
+// Dígitos 0-9 na linha 3: pares (página 0, página 1) por coluna
+static const uint8_t PAINEL_DIGITOS[10][16] = {
+  {
+    0xF0, 0x01, 0xF8, 0x03, 0xC8, 0x02, 0x68, 0x02, 0x38, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0x00, 0x00,
+  },
+  {
+    0x00, 0x00, 0x00, 0x02, 0x10, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
+  },
+  {
+    0x90, 0x03, 0xD8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x78, 0x02, 0x30, 0x02, 0x00, 0x00,
+  },
+  {
+    0x08, 0x02, 0x08, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xF8, 0x03, 0xB0, 0x01, 0x00, 0x00,
+  },
+  {
+    0xF0, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x80, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x00,
+  },
+  {
+    0x38, 0x01, 0x38, 0x03, 0x28, 0x02, 0x28, 0x02, 0x28, 0x02, 0xE8, 0x03, 0xC8, 0x01, 0x00, 0x00,
+  },
+  {
+    0xF0, 0x01, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xC8, 0x03, 0x80, 0x01, 0x00, 0x00,
+  },
+  {
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x03, 0x88, 0x03, 0xC8, 0x00, 0x78, 0x00, 0x38, 0x00, 0x00, 0x00,
+  },
+  {
+    0xB0, 0x01, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xF8, 0x03, 0xB0, 0x01, 0x00, 0x00,
+  },
+  {
+    0x30, 0x00, 0x78, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0x00, 0x00,
+  },
+};
+
+static const uint8_t PAINEL_ALERTA_UM[2][1024] = {
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xC7, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xC1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC7, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x87, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC7, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x84, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x47, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xC1, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x46, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xC7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xC1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xC7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x41, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xC7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xC7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x47, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x40, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x46, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xC7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x41, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+static const uint8_t PAINEL_ALERTA_DOIS[1024] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x01,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0xF0, 0xF1, 0x03, 0x00, 0x7C, 0xFC, 0x01, 0x00, 0xF8, 0x01, 0x06, 0x00, 0x7E, 0x24, 0x01,
+  0x00, 0x4C, 0x00, 0x06, 0x00, 0x13, 0x24, 0x01, 0x00, 0x44, 0x00, 0x06, 0x00, 0x11, 0x24, 0x01,
+  0x00, 0x4C, 0xF0, 0x03, 0x00, 0x13, 0x04, 0x01, 0x00, 0xF8, 0xF1, 0x01, 0x00, 0x7E, 0x04, 0x01,
+  0x00, 0xF0, 0x01, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0xFC, 0xE1, 0x07, 0x00, 0x7F, 0xFC, 0x01, 0x00, 0xFC, 0x31, 0x01, 0x00, 0x7F, 0x00, 0x01,
+  0x00, 0x00, 0x11, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x40, 0x00, 0x01,
+  0x00, 0x00, 0xE1, 0x07, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0xC1, 0x07, 0x00, 0x40, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFC, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x00, 0x24, 0x01, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x49, 0x00, 0x00,
+  0x00, 0x24, 0x01, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0xFC, 0x11, 0x04, 0x00, 0x7F, 0xFC, 0x01, 0x00, 0xFC, 0x11, 0x04, 0x00, 0x7F, 0x24, 0x01,
+  0x00, 0x24, 0xF0, 0x07, 0x00, 0x09, 0x24, 0x01, 0x00, 0x64, 0xF0, 0x07, 0x00, 0x19, 0x24, 0x01,
+  0x00, 0xE4, 0x10, 0x04, 0x00, 0x39, 0x04, 0x01, 0x00, 0xBC, 0x11, 0x04, 0x00, 0x6F, 0x04, 0x01,
+  0x00, 0x18, 0x01, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0x04, 0xF0, 0x07, 0x00, 0x01, 0xFC, 0x01, 0x00, 0x04, 0x60, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x04, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x81, 0x01, 0x00, 0x7F, 0x00, 0x01,
+  0x00, 0xFC, 0xF1, 0x07, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x04, 0xF0, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x01, 0xFC, 0x01,
+  0x00, 0xF0, 0x11, 0x00, 0x00, 0x7C, 0xFC, 0x01, 0x00, 0xF8, 0x11, 0x00, 0x00, 0x7E, 0x24, 0x01,
+  0x00, 0x4C, 0xF0, 0x07, 0x00, 0x13, 0x24, 0x01, 0x00, 0x44, 0xF0, 0x07, 0x00, 0x11, 0x24, 0x01,
+  0x00, 0x4C, 0x10, 0x00, 0x00, 0x13, 0x04, 0x01, 0x00, 0xF8, 0x11, 0x00, 0x00, 0x7E, 0x04, 0x01,
+  0x00, 0xF0, 0x11, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x80, 0x01,
+  0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x80, 0x01,
+  0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x01,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x4C, 0x00,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x4C, 0x00,
+  0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0xFC, 0x01,
+  0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x8C, 0x01,
+  0x00, 0x00, 0xB0, 0x07, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
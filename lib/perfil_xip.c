@@ -0,0 +1,7 @@
+#include "perfil_xip.h"
+
+Contador_xip perfil_xip[XIP_ESTAGIOS];
+
+const char *const perfil_xip_nomes[XIP_ESTAGIOS] = {
+    "aquisicao", "filtro", "canais", "historico", "telemetria", "entregas", "desenho", "envio", "matriz"
+};
@@ -0,0 +1,80 @@
+#ifndef PERFIL_XIP_H
+#define PERFIL_XIP_H
+
+#include <stdint.h>
+
+/**
+ * Contadores do cache XIP por estágio do pipeline
+ *
+ * Com PERFIL_XIP=1, XIP_MEDIR lê os contadores de acessos e acertos do
+ * cache XIP (e o relógio) antes e depois de cada estágio e acumula a
+ * diferença (XIP_INICIO/XIP_FIM delimitam trechos maiores). Os contadores são globais: o que interromper o estágio (ISR
+ * ou task de prioridade maior) entra na conta dele. Com PERFIL_XIP=0 a
+ * macro só executa o estágio.
+ */
+
+#ifndef PERFIL_XIP
+#define PERFIL_XIP 0
+#endif
+
+typedef enum {
+    XIP_AQUISICAO,     // Leitura dos canais
+    XIP_FILTRO,        // Filtro de picos
+    XIP_CANAIS,        // Calibração e classificação
+    XIP_HISTORICO,
+    XIP_TELEMETRIA,    // Publicação no anel
+    XIP_ENTREGAS,      // Envio às tasks consumidoras
+    XIP_DESENHO,       // Quadro do display no framebuffer
+    XIP_ENVIO,         // Framebuffer para o barramento I2C
+    XIP_MATRIZ,        // Quadro da matriz de LEDs
+    XIP_ESTAGIOS
+} EstagioXip;
+
+typedef struct {
+    volatile uint32_t chamadas;
+    volatile uint32_t acessos;     // Acessos à flash pelo cache
+    volatile uint32_t acertos;     // Acessos servidos pelo cache
+    volatile uint32_t tempo_us;
+} Contador_xip;
+
+extern Contador_xip perfil_xip[XIP_ESTAGIOS];
+extern const char *const perfil_xip_nomes[XIP_ESTAGIOS];
+
+#if PERFIL_XIP
+#include "pico/stdlib.h"
+#include "hardware/structs/xip_ctrl.h"
+
+typedef struct {
+    uint32_t acessos;
+    uint32_t acertos;
+    uint32_t instante_us;
+} Marca_xip;
+
+static inline Marca_xip perfil_xip_marca(void) {
+    Marca_xip m = {xip_ctrl_hw->ctr_acc, xip_ctrl_hw->ctr_hit, time_us_32()};
+    return m;
+}
+
+static inline void perfil_xip_somar(EstagioXip estagio, const Marca_xip *inicio) {
+    Marca_xip fim = perfil_xip_marca();
+    Contador_xip *c = &perfil_xip[estagio];
+    c->chamadas++;
+    c->acessos += fim.acessos - inicio->acessos;
+    c->acertos += fim.acertos - inicio->acertos;
+    c->tempo_us += fim.instante_us - inicio->instante_us;
+}
+
+#define XIP_MEDIR(estagio, ...) do { \
+    Marca_xip marca_ = perfil_xip_marca(); \
+    __VA_ARGS__; \
+    perfil_xip_somar(estagio, &marca_); \
+} while (0)
+#define XIP_INICIO(marca) Marca_xip marca = perfil_xip_marca()
+#define XIP_FIM(estagio, marca) perfil_xip_somar(estagio, &marca)
+#else
+#define XIP_MEDIR(estagio, ...) do { __VA_ARGS__; } while (0)
+#define XIP_INICIO(marca) do {} while (0)
+#define XIP_FIM(estagio, marca) do {} while (0)
+#endif
+
+#endif
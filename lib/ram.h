@@ -0,0 +1,26 @@
+#ifndef RAM_H
+#define RAM_H
+
+#include "pico/stdlib.h"
+
+/**
+ * Funções quentes (por amostra e por quadro) executadas da SRAM
+ *
+ * O código roda da flash QSPI pelo cache XIP; uma falta no cache custa
+ * dezenas de ciclos e torna o tempo das funções imprevisível. Com
+ * CODIGO_NA_RAM=1 as funções marcadas com NA_RAM vão para a seção
+ * .time_critical, copiada para a SRAM no boot. Com 0 ficam na flash, para
+ * comparar as duas colocações com PERFIL_XIP.
+ */
+
+#ifndef CODIGO_NA_RAM
+#define CODIGO_NA_RAM 0
+#endif
+
+#if CODIGO_NA_RAM
+#define NA_RAM(f) __not_in_flash_func(f)
+#else
+#define NA_RAM(f) f
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+#include "relogio.h"
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+const uint32_t relogio_khz[RELOGIO_NIVEIS] = {RELOGIO_NORMAL_KHZ, RELOGIO_ATENCAO_KHZ, RELOGIO_ALERTA_KHZ};
+
+/**
+ * Começa no nível da frequência atual (a de boot); sem correspondência,
+ * assume o mais alto até a primeira troca
+ */
+void relogio_init(Relogio *r, uint32_t agora_us) {
+    uint32_t khz = clock_get_hz(clk_sys) / 1000;
+
+    r->n_ouvintes = 0;
+    r->nivel = RELOGIO_NIVEIS - 1;
+    for (uint8_t i = 0; i < RELOGIO_NIVEIS; i++) {
+        if (relogio_khz[i] == khz)
+            r->nivel = i;
+    }
+    r->contabilizado_us = agora_us;
+    r->resto_us = 0;
+    r->abaixo = false;
+    r->trocas = 0;
+    r->troca_ultima_us = 0;
+    r->troca_max_us = 0;
+    r->programar_max_us = 0;
+    for (uint8_t i = 0; i < RELOGIO_NIVEIS; i++)
+        r->residencia_ms[i] = 0;
+}
+
+/**
+ * Cadastra um periférico; registre todos antes de iniciar o agendador
+ */
+bool relogio_registrar(Relogio *r, Relogio_ouvinte funcao, void *contexto) {
+    if (r->n_ouvintes >= RELOGIO_OUVINTES_MAX)
+        return false;
+    r->ouvintes[r->n_ouvintes].funcao = funcao;
+    r->ouvintes[r->n_ouvintes].contexto = contexto;
+    r->n_ouvintes++;
+    return true;
+}
+
+/**
+ * Nível pedido para o estado global atual: sobe na hora, desce só depois
+ * de RELOGIO_DESCIDA_US seguidos abaixo do nível atual
+ */
+uint8_t relogio_decidir(Relogio *r, uint8_t estado, uint32_t agora_us) {
+    if (estado >= RELOGIO_NIVEIS)
+        estado = RELOGIO_NIVEIS - 1;
+
+    if (estado >= r->nivel) {
+        r->abaixo = false;
+        return estado;
+    }
+    if (!r->abaixo) {
+        r->abaixo = true;
+        r->abaixo_desde_us = agora_us;
+    }
+    return agora_us - r->abaixo_desde_us >= RELOGIO_DESCIDA_US ? estado : r->nivel;
+}
+
+/**
+ * Soma o tempo desde a última contabilização ao nível atual. Chame ao
+ * menos a cada hora (o intervalo é medido em 32 bits de microssegundos).
+ */
+void relogio_contabilizar(Relogio *r, uint32_t agora_us) {
+    uint32_t decorrido = agora_us - r->contabilizado_us + r->resto_us;
+    r->contabilizado_us = agora_us;
+    r->residencia_ms[r->nivel] += decorrido / 1000;
+    r->resto_us = decorrido % 1000;
+}
+
+static void relogio_programar(uint32_t khz) {
+    if (khz == RELOGIO_NORMAL_KHZ) {
+        set_sys_clock_48mhz(); // clk_sys e clk_peri no PLL da USB; desliga o PLL do sistema
+    } else {
+        set_sys_clock_khz(khz, true);
+    }
+}
+
+/**
+ * Troca o clk_sys para o nível pedido e avisa os periféricos. Só uma task
+ * deve chamar (a mesma que chama relogio_decidir e relogio_contabilizar).
+ */
+void relogio_trocar(Relogio *r, uint8_t nivel) {
+    if (nivel >= RELOGIO_NIVEIS || nivel == r->nivel)
+        return;
+
+    uint32_t inicio = time_us_32();
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    for (uint8_t i = 0; i < r->n_ouvintes; i++)
+        r->ouvintes[i].funcao(RELOGIO_ANTES, sys_hz, r->ouvintes[i].contexto);
+
+    // Nenhuma task roda com os periféricos na configuração da frequência antiga
+    vTaskSuspendAll();
+    uint32_t inicio_programar = time_us_32();
+    relogio_contabilizar(r, inicio_programar);
+    relogio_programar(relogio_khz[nivel]);
+    r->nivel = nivel;
+    r->abaixo = false;
+    uint32_t programar = time_us_32() - inicio_programar;
+
+    // O SysTick do FreeRTOS conta ciclos do clk_sys: recarga para o mesmo tick
+    sys_hz = clock_get_hz(clk_sys);
+    systick_hw->rvr = sys_hz / configTICK_RATE_HZ - 1;
+    systick_hw->cvr = 0;
+
+    for (uint8_t i = r->n_ouvintes; i-- > 0;)
+        r->ouvintes[i].funcao(RELOGIO_DEPOIS, sys_hz, r->ouvintes[i].contexto);
+    xTaskResumeAll();
+
+    // API do FreeRTOS não pode ser usada com o agendador suspenso
+    for (uint8_t i = r->n_ouvintes; i-- > 0;)
+        r->ouvintes[i].funcao(RELOGIO_RETOMADO, sys_hz, r->ouvintes[i].contexto);
+
+    uint32_t total = time_us_32() - inicio;
+    r->trocas++;
+    r->troca_ultima_us = total;
+    if (total > r->troca_max_us)
+        r->troca_max_us = total;
+    if (programar > r->programar_max_us)
+        r->programar_max_us = programar;
+}
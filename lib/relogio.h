@@ -0,0 +1,95 @@
+#ifndef RELOGIO_H
+#define RELOGIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Frequência do clk_sys conforme o estado de alerta da estação
+ *
+ * Em estado normal a estação só amostra e atualiza o painel, então roda
+ * com o clk_sys no PLL da USB (48 MHz) e o PLL do sistema desligado; em
+ * atenção e alerta sobe para renderizar e reagir mais rápido. A subida é
+ * imediata e a descida só acontece depois de RELOGIO_DESCIDA_US seguidos
+ * abaixo do nível atual, para o relógio não oscilar perto dos limiares.
+ *
+ * No RP2040 o clk_peri segue o clk_sys, então PWM, PIO e I2C precisam ser
+ * recalculados a cada troca: cada periférico registra um ouvinte chamado
+ * antes da troca (ainda na frequência antiga, pode bloquear para terminar
+ * uma transferência; como as outras tasks ainda rodam, o ouvinte também
+ * impede que comecem transferências novas até o DEPOIS), depois dela (na nova, com o agendador suspenso: só
+ * registros de hardware, nenhuma chamada do FreeRTOS) e com o agendador já
+ * retomado (para liberar filas e semáforos). O SysTick do FreeRTOS é
+ * recarregado na própria troca; o timer e a USB têm relógios próprios.
+ *
+ * Também mede o custo de cada troca e o tempo em cada nível. A energia por
+ * nível não é medida (a placa não tem sensor de corrente): é uma estimativa
+ * de um modelo linear de corrente x frequência.
+ */
+
+#define RELOGIO_NIVEIS 3              // Um por EstadoCanal
+#define RELOGIO_OUVINTES_MAX 6
+#define RELOGIO_NORMAL_KHZ 48000      // PLL da USB; o PLL do sistema fica desligado
+#define RELOGIO_ATENCAO_KHZ 125000    // Frequência de boot do SDK
+#define RELOGIO_ALERTA_KHZ 133000     // Máximo nominal do RP2040, sem mexer na tensão do núcleo
+#define RELOGIO_DESCIDA_US 10000000   // Tempo abaixo do nível atual antes de descer
+
+// Modelo de consumo da placa a 3,3 V: base + por MHz, mais o PLL do sistema
+// quando ligado. Valores típicos da folha de dados; calibrar com um medidor.
+#define RELOGIO_MV 3300
+#define RELOGIO_UA_BASE 5000
+#define RELOGIO_UA_POR_MHZ 150
+#define RELOGIO_UA_PLL_SYS 1500
+
+extern const uint32_t relogio_khz[RELOGIO_NIVEIS];
+
+typedef enum {
+    RELOGIO_ANTES,     // Ainda na frequência antiga; pode bloquear
+    RELOGIO_DEPOIS,    // Já na nova; agendador suspenso, só registros de hardware
+    RELOGIO_RETOMADO   // Agendador retomado; pode usar filas e semáforos
+} EventoRelogio;
+
+typedef void (*Relogio_ouvinte)(EventoRelogio evento, uint32_t sys_hz, void *contexto);
+
+typedef struct {
+    struct {
+        Relogio_ouvinte funcao;
+        void *contexto;
+    } ouvintes[RELOGIO_OUVINTES_MAX];
+    uint8_t n_ouvintes;
+
+    volatile uint8_t nivel;
+    uint32_t contabilizado_us;          // Residência somada até este instante
+    uint32_t resto_us;                  // Fração de ms ainda não somada
+    uint32_t abaixo_desde_us;           // Início do período abaixo do nível atual
+    bool abaixo;
+
+    volatile uint32_t trocas;
+    volatile uint32_t troca_ultima_us;  // Ouvintes + reprogramação dos clocks
+    volatile uint32_t troca_max_us;
+    volatile uint32_t programar_max_us; // Só a reprogramação (PLL e multiplexadores)
+    volatile uint32_t residencia_ms[RELOGIO_NIVEIS];
+} Relogio;
+
+void relogio_init(Relogio *r, uint32_t agora_us);
+bool relogio_registrar(Relogio *r, Relogio_ouvinte funcao, void *contexto);
+uint8_t relogio_decidir(Relogio *r, uint8_t estado, uint32_t agora_us);
+void relogio_trocar(Relogio *r, uint8_t nivel);
+void relogio_contabilizar(Relogio *r, uint32_t agora_us);
+
+/**
+ * Corrente estimada da placa na frequência dada, em microampères
+ */
+static inline uint32_t relogio_corrente_ua(uint32_t khz) {
+    uint32_t ua = RELOGIO_UA_BASE + RELOGIO_UA_POR_MHZ * khz / 1000;
+    return khz == RELOGIO_NORMAL_KHZ ? ua : ua + RELOGIO_UA_PLL_SYS;
+}
+
+/**
+ * Energia estimada de ms milissegundos na frequência dada, em milijoules
+ */
+static inline uint32_t relogio_energia_mj(uint32_t khz, uint32_t ms) {
+    return (uint32_t)((uint64_t)RELOGIO_MV * relogio_corrente_ua(khz) * ms / 1000000000u);
+}
+
+#endif
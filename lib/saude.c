@@ -0,0 +1,77 @@
+#include "saude.h"
+#include "ram.h"
+#include <string.h>
+
+void saude_init(Saude *s, Saude_estouro estouro) {
+    memset(s, 0, sizeof(*s));
+    s->estouro = estouro;
+}
+
+/**
+ * Cadastra uma task periódica; retorna o índice ou -1 se não houver espaço
+ */
+int saude_registrar(Saude *s, const char *nome, uint32_t periodo_us, uint32_t prazo_us) {
+    if (s->n >= SAUDE_TAREFAS_MAX)
+        return -1;
+
+    uint8_t i = s->n++;
+    s->tarefas[i].nome = nome;
+    saude_periodo(s, i, periodo_us, prazo_us);
+    return i;
+}
+
+/**
+ * Troca o período (ex.: nova taxa de amostragem); a próxima ativação
+ * recomeça a contagem dos instantes previstos
+ */
+void saude_periodo(Saude *s, uint8_t tarefa, uint32_t periodo_us, uint32_t prazo_us) {
+    Monitor_tarefa *m = &s->tarefas[tarefa];
+    m->iniciado = false;
+    m->periodo_us = periodo_us;
+    m->prazo_us = prazo_us;
+}
+
+void NA_RAM(saude_inicio)(Saude *s, uint8_t tarefa, uint32_t agora_us) {
+    Monitor_tarefa *m = &s->tarefas[tarefa];
+
+    if (!m->iniciado) {
+        m->previsto_us = agora_us;
+        m->iniciado = true;
+    }
+
+    // Períodos inteiros sem ativação contam como perdidos
+    while ((int32_t)(agora_us - m->previsto_us) >= (int32_t)m->periodo_us) {
+        m->previsto_us += m->periodo_us;
+        m->perdas++;
+    }
+
+    // Ativação adiantada (relógio do timer x relógio do sistema) conta como atraso 0
+    int32_t atraso = (int32_t)(agora_us - m->previsto_us);
+    uint32_t a = atraso > 0 ? (uint32_t)atraso : 0;
+    m->hist_atraso[saude_balde(a)]++;
+    if (a > m->atraso_max_us)
+        m->atraso_max_us = a;
+
+    m->inicio_us = agora_us;
+    m->ativacoes++;
+}
+
+void NA_RAM(saude_fim)(Saude *s, uint8_t tarefa, uint32_t agora_us) {
+    Monitor_tarefa *m = &s->tarefas[tarefa];
+    if (!m->iniciado)
+        return; // Período trocado no meio da ativação
+
+    uint32_t execucao = agora_us - m->inicio_us;
+    m->hist_execucao[saude_balde(execucao)]++;
+    if (execucao > m->execucao_max_us)
+        m->execucao_max_us = execucao;
+
+    uint32_t resposta = agora_us - m->previsto_us;
+    if (resposta > m->prazo_us) {
+        m->perdas++;
+        m->ultimo_estouro_us = resposta;
+        if (s->estouro != NULL)
+            s->estouro(tarefa, resposta);
+    }
+    m->previsto_us += m->periodo_us;
+}
@@ -0,0 +1,65 @@
+#ifndef SAUDE_H
+#define SAUDE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Monitor de prazos das tasks periódicas
+ *
+ * Cada task periódica marca o início e o fim de cada ativação. O monitor
+ * compara o início com o instante previsto pelo período (atraso de
+ * ativação, ou jitter) e o fim com o prazo, e acumula atraso e tempo de
+ * execução em histogramas de tamanho fixo com baldes em potências de 2.
+ * Um prazo estourado chama o gancho registrado.
+ *
+ * As contagens dos histogramas só crescem; quem lê calcula a diferença
+ * entre dois relatórios.
+ */
+
+#define SAUDE_TAREFAS_MAX 4
+#define SAUDE_BALDES 16
+#define SAUDE_BALDE_LOG2 2     // Balde 0: < 4 us; balde k: [4 << (k-1), 4 << k) us; o último satura
+
+// Chamado na task que estourou o prazo, com o tempo de resposta da ativação
+typedef void (*Saude_estouro)(uint8_t tarefa, uint32_t resposta_us);
+
+typedef struct {
+    const char *nome;
+    uint32_t periodo_us;
+    uint32_t prazo_us;                  // Relativo ao instante previsto da ativação
+    uint32_t previsto_us;               // Próxima ativação pelo período
+    uint32_t inicio_us;                 // Início da ativação atual
+    bool iniciado;                      // previsto_us válido
+
+    volatile uint32_t ativacoes;
+    volatile uint32_t perdas;           // Prazos estourados e períodos pulados
+    volatile uint32_t atraso_max_us;
+    volatile uint32_t execucao_max_us;
+    volatile uint32_t ultimo_estouro_us; // Tempo de resposta do último estouro
+    volatile uint32_t hist_atraso[SAUDE_BALDES];
+    volatile uint32_t hist_execucao[SAUDE_BALDES];
+} Monitor_tarefa;
+
+typedef struct {
+    Monitor_tarefa tarefas[SAUDE_TAREFAS_MAX];
+    uint8_t n;
+    Saude_estouro estouro;
+} Saude;
+
+void saude_init(Saude *s, Saude_estouro estouro);
+int saude_registrar(Saude *s, const char *nome, uint32_t periodo_us, uint32_t prazo_us);
+void saude_periodo(Saude *s, uint8_t tarefa, uint32_t periodo_us, uint32_t prazo_us);
+void saude_inicio(Saude *s, uint8_t tarefa, uint32_t agora_us);
+void saude_fim(Saude *s, uint8_t tarefa, uint32_t agora_us);
+
+/**
+ * Balde do histograma de uma duração em microssegundos
+ */
+static inline uint8_t saude_balde(uint32_t us) {
+    uint32_t v = us >> SAUDE_BALDE_LOG2;
+    uint8_t k = v ? (uint8_t)(32 - __builtin_clz(v)) : 0;
+    return k < SAUDE_BALDES ? k : SAUDE_BALDES - 1;
+}
+
+#endif
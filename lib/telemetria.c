@@ -0,0 +1,217 @@
+#include "telemetria.h"
+#include "ram.h"
+#include <string.h>
+
+// ================= SERIALIZAÇÃO =================
+
+static uint8_t *escrever_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *escrever_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+static uint8_t *escrever_cabecalho(uint8_t *p, TipoTelemetria tipo, uint32_t instante_us) {
+    *p++ = (uint8_t)tipo;
+    p = escrever_u16(p, 0); // seq é preenchido no envio
+    return escrever_u32(p, instante_us);
+}
+
+/**
+ * CRC-16/CCITT-FALSE (poli 0x1021, inicial 0xFFFF) com tabela de 16 entradas
+ */
+uint16_t telemetria_crc16(const uint8_t *dados, size_t tamanho) {
+    static const uint16_t tabela[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    };
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < tamanho; i++) {
+        crc = (crc << 4) ^ tabela[(crc >> 12) ^ (dados[i] >> 4)];
+        crc = (crc << 4) ^ tabela[(crc >> 12) ^ (dados[i] & 0x0F)];
+    }
+    return crc;
+}
+
+/**
+ * Codifica em COBS; a saída não contém 0x00 e tem no máximo tamanho + tamanho/254 + 1 bytes
+ */
+size_t cobs_codificar(const uint8_t *entrada, size_t tamanho, uint8_t *saida) {
+    size_t codigo_pos = 0, o = 1;
+    uint8_t codigo = 1;
+
+    for (size_t i = 0; i < tamanho; i++) {
+        if (entrada[i] == 0) {
+            saida[codigo_pos] = codigo;
+            codigo_pos = o++;
+            codigo = 1;
+        } else {
+            saida[o++] = entrada[i];
+            if (++codigo == 0xFF) {
+                saida[codigo_pos] = codigo;
+                codigo_pos = o++;
+                codigo = 1;
+            }
+        }
+    }
+    saida[codigo_pos] = codigo;
+    return o;
+}
+
+/**
+ * Decodifica um bloco COBS (sem o 0x00 final); retorna 0 se estiver malformado
+ */
+size_t cobs_decodificar(const uint8_t *entrada, size_t tamanho, uint8_t *saida) {
+    size_t i = 0, o = 0;
+
+    while (i < tamanho) {
+        uint8_t codigo = entrada[i++];
+        if (codigo == 0 || i + codigo - 1 > tamanho)
+            return 0;
+        for (uint8_t k = 1; k < codigo; k++)
+            saida[o++] = entrada[i++];
+        if (codigo != 0xFF && i < tamanho)
+            saida[o++] = 0;
+    }
+    return o;
+}
+
+/**
+ * Monta o quadro completo (COBS + delimitador) de um registro; retorna o tamanho
+ */
+size_t telemetria_quadro(const uint8_t *registro, size_t tamanho, uint16_t seq, uint8_t *quadro) {
+    uint8_t bruto[TELEM_REGISTRO_MAX + 2];
+
+    memcpy(bruto, registro, tamanho);
+    escrever_u16(&bruto[1], seq);
+    escrever_u16(&bruto[tamanho], telemetria_crc16(bruto, tamanho));
+
+    size_t n = cobs_codificar(bruto, tamanho + 2, quadro);
+    quadro[n++] = 0x00;
+    return n;
+}
+
+/**
+ * Registro genérico com até TELEM_CARGA_MAX / 4 valores de 32 bits
+ */
+size_t telemetria_valores(TipoTelemetria tipo, uint32_t instante_us, const uint32_t *valores,
+                          uint8_t n, uint8_t *registro) {
+    uint8_t *p = escrever_cabecalho(registro, tipo, instante_us);
+    for (uint8_t i = 0; i < n && i < TELEM_CARGA_MAX / 4; i++)
+        p = escrever_u32(p, valores[i]);
+    return (size_t)(p - registro);
+}
+
+/**
+ * Registro com até TELEM_CARGA_MAX bytes já serializados pelo chamador
+ */
+size_t telemetria_bytes(TipoTelemetria tipo, uint32_t instante_us, const uint8_t *dados,
+                        uint8_t n, uint8_t *registro) {
+    uint8_t *p = escrever_cabecalho(registro, tipo, instante_us);
+    n = n < TELEM_CARGA_MAX ? n : TELEM_CARGA_MAX;
+    memcpy(p, dados, n);
+    return (size_t)(p + n - registro);
+}
+
+/**
+ * Registro com os contadores de publicação e envio (montado pelo consumidor)
+ */
+size_t telemetria_contadores(const Anel_telemetria *anel, const Contadores_envio *envio,
+                             uint32_t instante_us, uint8_t *registro) {
+    const uint32_t valores[] = {anel->publicados, anel->descartados, envio->enviados, envio->bytes};
+    return telemetria_valores(TELEM_CONTADORES, instante_us, valores, 4, registro);
+}
+
+// ================= ANEL LOCK-FREE =================
+
+void telemetria_init(Anel_telemetria *anel) {
+    atomic_store_explicit(&anel->cabeca, 0, memory_order_relaxed);
+    atomic_store_explicit(&anel->cauda, 0, memory_order_relaxed);
+    anel->publicados = 0;
+    anel->descartados = 0;
+}
+
+/**
+ * Reserva a próxima posição livre; retorna NULL (e conta o descarte) se o anel estiver cheio
+ */
+static Registro_telemetria *NA_RAM(reservar)(Anel_telemetria *anel) {
+    uint32_t cabeca = atomic_load_explicit(&anel->cabeca, memory_order_relaxed);
+    uint32_t cauda = atomic_load_explicit(&anel->cauda, memory_order_acquire);
+
+    if (cabeca - cauda >= TELEM_ANEL_TAMANHO) {
+        anel->descartados++;
+        return NULL;
+    }
+    return &anel->registros[cabeca & (TELEM_ANEL_TAMANHO - 1)];
+}
+
+static void NA_RAM(confirmar)(Anel_telemetria *anel) {
+    uint32_t cabeca = atomic_load_explicit(&anel->cabeca, memory_order_relaxed);
+    atomic_store_explicit(&anel->cabeca, cabeca + 1, memory_order_release);
+    anel->publicados++;
+}
+
+bool NA_RAM(telemetria_publicar_amostra)(Anel_telemetria *anel, const Dados_analogicos *dados) {
+    Registro_telemetria *r = reservar(anel);
+    if (r == NULL)
+        return false;
+
+    uint8_t *p = escrever_cabecalho(r->dados, TELEM_AMOSTRA, dados->instante_us);
+    *p++ = dados->n;
+    *p++ = dados->estado_global;
+    for (uint8_t i = 0; i < dados->n; i++) {
+        p = escrever_u16(p, dados->valor[i]);
+        *p++ = dados->estado[i];
+    }
+    r->tamanho = (uint8_t)(p - r->dados);
+
+    confirmar(anel);
+    return true;
+}
+
+bool NA_RAM(telemetria_publicar_evento)(Anel_telemetria *anel, uint32_t instante_us, uint8_t canal,
+                                uint8_t anterior, uint8_t novo, uint16_t valor) {
+    Registro_telemetria *r = reservar(anel);
+    if (r == NULL)
+        return false;
+
+    uint8_t *p = escrever_cabecalho(r->dados, TELEM_EVENTO, instante_us);
+    *p++ = canal;
+    *p++ = anterior;
+    *p++ = novo;
+    p = escrever_u16(p, valor);
+    r->tamanho = (uint8_t)(p - r->dados);
+
+    confirmar(anel);
+    return true;
+}
+
+/**
+ * Copia o registro mais antigo para o consumidor; retorna false se o anel estiver vazio
+ */
+bool telemetria_retirar(Anel_telemetria *anel, Registro_telemetria *registro) {
+    uint32_t cauda = atomic_load_explicit(&anel->cauda, memory_order_relaxed);
+    uint32_t cabeca = atomic_load_explicit(&anel->cabeca, memory_order_acquire);
+
+    if (cabeca == cauda)
+        return false;
+
+    const Registro_telemetria *r = &anel->registros[cauda & (TELEM_ANEL_TAMANHO - 1)];
+    registro->tamanho = r->tamanho;
+    memcpy(registro->dados, r->dados, r->tamanho);
+
+    atomic_store_explicit(&anel->cauda, cauda + 1, memory_order_release);
+    return true;
+}
+
+uint32_t telemetria_pendentes(Anel_telemetria *anel) {
+    return atomic_load_explicit(&anel->cabeca, memory_order_acquire) -
+           atomic_load_explicit(&anel->cauda, memory_order_acquire);
+}
@@ -0,0 +1,88 @@
+#ifndef TELEMETRIA_H
+#define TELEMETRIA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "canais.h"
+
+/**
+ * Telemetria binária da estação
+ *
+ * Cada registro é serializado como:
+ *   tipo(1) seq(2) instante_us(4) carga(...) crc16(2)
+ * codificado em COBS e terminado por 0x00. Campos multibyte em little-endian;
+ * o CRC é CRC-16/CCITT-FALSE sobre tudo que vem antes dele.
+ *
+ * A fila entre quem mede e quem transmite é um anel lock-free de um produtor
+ * e um consumidor: o produtor nunca bloqueia, e registros que não cabem são
+ * descartados e contados.
+ */
+
+#ifndef TELEM_ANEL_TAMANHO
+#define TELEM_ANEL_TAMANHO 32   // Registros no anel (potência de 2)
+#endif
+
+typedef enum {
+    TELEM_AMOSTRA = 1,      // n(1) estado_global(1) {valor(2) estado(1)} x n
+    TELEM_EVENTO = 2,       // canal(1) anterior(1) novo(1) valor(2)
+    TELEM_CONTADORES = 3,   // publicados(4) descartados(4) enviados(4) bytes(4)
+    TELEM_DISPLAY = 4,      // quadros(4) perdidos(4) tempo_us(4) tempo_max_us(4)
+    TELEM_BOOT = 5,         // fase(4) instante_us(4) build(4) alterado(4)
+    TELEM_ESTRESSE = 6,     // taxa_hz(4) amostras(4) perdas(4) maior_ok(4) concluida(4) descartados_telemetria(4)
+    TELEM_I2C = 7,          // cliente(4) transacoes(4) bytes(4) erros(4) ocupado_us(4) espera_max_us(4) recuperacoes(4)
+    TELEM_CONFIG = 8,       // resultado(4) versao(4) amostragem_hz(4) gravada(4), resposta a um comando
+    TELEM_SAUDE = 9,        // tarefa(4) ativacoes(4) perdas(4) atraso_max_us(4) execucao_max_us(4) ultimo_estouro_us(4)
+    TELEM_HISTOGRAMA = 10,  // tarefa(1) tipo(1) {contagem mod 2^16 (2)} x 16; tipo 0 = atraso, 1 = execução
+    TELEM_PILHA = 11,       // livre_bytes(4) nome(...)
+    TELEM_FALHA = 12,       // tipo(4) nome(...): estouro de pilha ou heap esgotado antes do último reset
+    TELEM_XIP = 13,         // estagio(4) chamadas(4) acessos(4) acertos(4) tempo_us(4), só com PERFIL_XIP
+    TELEM_RELOGIO = 14      // khz(4) trocas(4) troca_ultima_us(4) troca_max_us(4) programar_max_us(4) residencia_ms(4) x 3
+} TipoTelemetria;
+
+#define TELEM_CABECALHO 7
+#define TELEM_CARGA_MAX ((2 + 3 * CANAIS_MAX) > 34 ? (2 + 3 * CANAIS_MAX) : 34)
+#define TELEM_REGISTRO_MAX (TELEM_CABECALHO + TELEM_CARGA_MAX)
+#define TELEM_QUADRO_MAX (TELEM_REGISTRO_MAX + 2 + (TELEM_REGISTRO_MAX + 2) / 254 + 2)
+
+typedef struct {
+    uint8_t tamanho;
+    uint8_t dados[TELEM_REGISTRO_MAX];   // Registro sem CRC (seq preenchido no envio)
+} Registro_telemetria;
+
+typedef struct {
+    Registro_telemetria registros[TELEM_ANEL_TAMANHO];
+    atomic_uint_fast32_t cabeca;     // Escrito só pelo produtor
+    atomic_uint_fast32_t cauda;      // Escrito só pelo consumidor
+    uint32_t publicados;
+    uint32_t descartados;
+} Anel_telemetria;
+
+typedef struct {
+    uint16_t seq;
+    uint32_t enviados;
+    uint32_t bytes;
+} Contadores_envio;
+
+// Anel (produtor/consumidor)
+void telemetria_init(Anel_telemetria *anel);
+bool telemetria_publicar_amostra(Anel_telemetria *anel, const Dados_analogicos *dados);
+bool telemetria_publicar_evento(Anel_telemetria *anel, uint32_t instante_us, uint8_t canal,
+                                uint8_t anterior, uint8_t novo, uint16_t valor);
+bool telemetria_retirar(Anel_telemetria *anel, Registro_telemetria *registro);
+uint32_t telemetria_pendentes(Anel_telemetria *anel);
+
+// Enquadramento
+size_t telemetria_valores(TipoTelemetria tipo, uint32_t instante_us, const uint32_t *valores,
+                          uint8_t n, uint8_t *registro);
+size_t telemetria_bytes(TipoTelemetria tipo, uint32_t instante_us, const uint8_t *dados,
+                         uint8_t n, uint8_t *registro);
+size_t telemetria_contadores(const Anel_telemetria *anel, const Contadores_envio *envio,
+                             uint32_t instante_us, uint8_t *registro);
+size_t telemetria_quadro(const uint8_t *registro, size_t tamanho, uint16_t seq, uint8_t *quadro);
+uint16_t telemetria_crc16(const uint8_t *dados, size_t tamanho);
+size_t cobs_codificar(const uint8_t *entrada, size_t tamanho, uint8_t *saida);
+size_t cobs_decodificar(const uint8_t *entrada, size_t tamanho, uint8_t *saida);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Benchmark de host da tabela de canais
+ *
+ * Mede o custo por amostra de aquisição + calibração + classificação
+ * conforme o número de canais cresce.
+ *
+ * Uso: make -C tools bench_canais && tools/bin/bench_canais
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "canais.h"
+
+#define AMOSTRAS 200000
+
+static uint32_t semente = 12345;
+
+// Fonte simulada: ruído pseudoaleatório de 12 bits
+static uint16_t ler_simulado(uint8_t entrada) {
+    semente = semente * 1664525u + 1013904223u;
+    return (uint16_t)((semente >> 20) + entrada) & 0x0FFF;
+}
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void) {
+    static const uint8_t tamanhos[] = {1, 2, 4, 8, 16, 32, 48, 64};
+    Tabela_canais t;
+    Dados_analogicos d;
+    volatile uint32_t alertas = 0;
+
+    printf("CANAIS_MAX=%d, %d amostras por medida\n", CANAIS_MAX, AMOSTRAS);
+    printf("%8s %14s %16s\n", "canais", "ns/amostra", "ns/canal");
+
+    for (unsigned k = 0; k < sizeof(tamanhos); k++) {
+        uint8_t n = tamanhos[k];
+        if (n > CANAIS_MAX)
+            break;
+
+        canais_init(&t);
+        canais_registrar_leitor(&t, FONTE_SIMULADA, ler_simulado);
+        for (uint8_t i = 0; i < n; i++)
+            canais_adicionar(&t, "CANAL", "CANAL ELEVADO", FONTE_SIMULADA, i,
+                             (uint16_t)(i * 8), 4088, 400, 700 + (i % 3) * 50);
+
+        double t0 = agora_ns();
+        for (int a = 0; a < AMOSTRAS; a++) {
+            canais_adquirir(&t, d.bruto);
+            canais_processar(&t, &d);
+            alertas += d.estado_global == ESTADO_ALERTA;
+        }
+        double ns = (agora_ns() - t0) / AMOSTRAS;
+
+        printf("%8u %14.1f %16.2f\n", n, ns, ns / n);
+    }
+
+    printf("(amostras em alerta: %u)\n", (unsigned)alertas);
+    return 0;
+}
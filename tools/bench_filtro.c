@@ -0,0 +1,128 @@
+/**
+ * Benchmark de host do filtro de picos
+ *
+ * Confere a rede de ordenação (princípio 0-1 e valores aleatórios contra
+ * qsort), mostra quantos picos de um sinal ruidoso chegariam ao alerta com
+ * e sem filtro e mede o custo por amostra de cada modo. Falha também se o
+ * Hampel trocar mais ou menos leituras que os picos injetados (fora de
+ * TOLERANCIA_REJEITADOS), ou seja, se o ruído comum passar por pico. A 1 kHz com dois
+ * canais o orçamento do alvo é de 1 ms por amostra; aqui só a ordem de
+ * grandeza importa (o host é bem mais rápido que o RP2040).
+ *
+ * Uso: make -C tools bench_filtro && tools/bin/bench_filtro
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "filtro.h"
+
+#define AMOSTRAS 2000000
+#define LIMIAR_ALERTA 3270        // 80% de 4088 em contagens brutas
+#define TOLERANCIA_REJEITADOS 5   // % de diferença aceita entre rejeitados e picos (bordas dos degraus)
+
+static uint32_t semente = 12345;
+
+static uint32_t aleatorio(void) {
+    semente = semente * 1664525u + 1013904223u;
+    return semente >> 8;
+}
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int comparar(const void *a, const void *b) {
+    return *(const uint16_t *)a - *(const uint16_t *)b;
+}
+
+// Nível de 40% com ruído de +-20 contagens e picos de motor em 0,5% das amostras
+static uint16_t sinal(uint32_t k, int *pico) {
+    *pico = aleatorio() % 200 == 0;
+    if (*pico)
+        return 4000 + aleatorio() % 95;
+    return (uint16_t)(1635 + aleatorio() % 41 - 20 + (k / 20000 % 2) * 1200);
+}
+
+int main(void) {
+    int erros = 0;
+
+    // Princípio 0-1: a rede ordena tudo se ordena todas as entradas binárias
+    for (unsigned m = 0; m < (1u << FILTRO_JANELA); m++) {
+        uint16_t janela[FILTRO_JANELA];
+        unsigned uns = 0;
+        for (unsigned i = 0; i < FILTRO_JANELA; i++) {
+            janela[i] = (m >> i) & 1;
+            uns += janela[i];
+        }
+        if (filtro_mediana(janela) != (uns > FILTRO_JANELA / 2))
+            erros++;
+    }
+    for (int r = 0; r < 100000; r++) {
+        uint16_t janela[FILTRO_JANELA], ordenada[FILTRO_JANELA];
+        for (unsigned i = 0; i < FILTRO_JANELA; i++)
+            janela[i] = ordenada[i] = aleatorio() & 0x0FFF;
+        qsort(ordenada, FILTRO_JANELA, sizeof(uint16_t), comparar);
+        if (filtro_mediana(janela) != ordenada[FILTRO_JANELA / 2])
+            erros++;
+    }
+    printf("rede de ordenação (janela %d): %s (%d erros)\n", FILTRO_JANELA, erros ? "FALHOU" : "ok", erros);
+
+    // Picos que cruzam o limiar de alerta em cada modo
+    static const struct { const char *nome; ModoFiltro modo; uint16_t passo; } modos[] = {
+        {"nenhum", FILTRO_NENHUM, 0},
+        {"mediana", FILTRO_MEDIANA, 0},
+        {"hampel", FILTRO_HAMPEL, 0},
+        {"hampel+taxa", FILTRO_HAMPEL, 200},
+    };
+    const unsigned n_modos = sizeof(modos) / sizeof(modos[0]);
+
+    printf("\n%-12s %10s %14s %12s %12s\n", "modo", "picos", "falsos alerta", "rejeitados", "ns/amostra");
+    int rejeicao_errada = 0;
+    for (unsigned m = 0; m < n_modos; m++) {
+        Filtro f;
+        filtro_init(&f);
+        filtro_configurar(&f, 0, modos[m].modo, modos[m].passo);
+        filtro_configurar(&f, 1, modos[m].modo, modos[m].passo);
+
+        unsigned picos = 0, falsos = 0;
+        semente = 12345;
+        for (uint32_t k = 0; k < 200000; k++) {
+            int pico;
+            uint16_t bruto[2];
+            bruto[0] = sinal(k, &pico);
+            bruto[1] = bruto[0];
+            picos += pico;
+            filtro_aplicar(&f, bruto, 2);
+            falsos += bruto[0] > LIMIAR_ALERTA;
+        }
+        uint32_t rejeitados = f.rejeitados[0];
+
+        // Custo: dois canais por amostra, entradas pré-geradas
+        static uint16_t entradas[4096][2];
+        for (unsigned i = 0; i < 4096; i++) {
+            int pico;
+            entradas[i][0] = entradas[i][1] = sinal(i, &pico);
+        }
+        double t0 = agora_ns();
+        for (uint32_t k = 0; k < AMOSTRAS; k++) {
+            uint16_t bruto[2] = {entradas[k & 4095][0], entradas[k & 4095][1]};
+            filtro_aplicar(&f, bruto, 2);
+        }
+        double ns = (agora_ns() - t0) / AMOSTRAS;
+
+        // Hampel: cada leitura trocada deve ser um pico, e cada pico trocado
+        int fora = modos[m].modo == FILTRO_HAMPEL &&
+                   (rejeitados * 100 < picos * (100 - TOLERANCIA_REJEITADOS) ||
+                    rejeitados * 100 > picos * (100 + TOLERANCIA_REJEITADOS));
+        rejeicao_errada += fora;
+        printf("%-12s %10u %14u %12u %12.1f%s\n", modos[m].nome, picos, falsos, rejeitados, ns,
+               fora ? "  <- rejeitados longe dos picos" : "");
+    }
+    if (rejeicao_errada)
+        printf("\nFALHOU: o Hampel trocou leituras fora de +-%d%% dos picos injetados\n", TOLERANCIA_REJEITADOS);
+    return erros != 0 || rejeicao_errada != 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * Benchmark de host do painel: renderização runtime x pré-renderizada
+ *
+ * Confere byte a byte que as duas versões geram o mesmo ram_buffer para
+ * todos os percentuais, telas de alerta e gráficos de histórico, e mede o
+ * custo de cada uma.
+ *
+ * Uso: make -C tools bench_painel && tools/bin/bench_painel
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "painel.h"
+
+#define REPETICOES 200
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void) {
+    Tabela_canais t;
+    Dados_analogicos d = {0};
+    ssd1306_t a, b;
+    int divergencias = 0;
+
+    canais_init(&t);
+    canais_adicionar(&t, "CHUVA", "CHUVA INTENSA", FONTE_ADC, 1, 0, 4088, 400, 800);
+    canais_adicionar(&t, "NIVEL", "NIVEL ELEVADO", FONTE_ADC, 0, 0, 4088, 400, 700);
+    ssd1306_init(&a, WIDTH, HEIGHT, false, 0x3C, NULL);
+    ssd1306_init(&b, WIDTH, HEIGHT, false, 0x3C, NULL);
+    d.n = 2;
+
+    // Conferência: todos os percentuais em cada coluna
+    for (int v = 0; v <= CANAIS_ESCALA; v++) {
+        d.valor[0] = (uint16_t)v;
+        d.valor[1] = (uint16_t)(CANAIS_ESCALA - v);
+        memset(b.ram_buffer + 1, 0xA5, b.bufsize - 1); // Sujeira: tudo deve ser sobrescrito
+        painel_dashboard_runtime(&a, &t, &d, 0);
+        painel_dashboard(&b, &t, &d, 0);
+        if (memcmp(a.ram_buffer, b.ram_buffer, a.bufsize) != 0) {
+            if (divergencias++ < 5)
+                printf("DIVERGE: painel com valores %d/%d\n", d.valor[0], d.valor[1]);
+        }
+    }
+    const char *alertas[][2] = {
+        {"CHUVA INTENSA", NULL}, {"NIVEL ELEVADO", NULL}, {"CHUVA INTENSA", "NIVEL ELEVADO"}
+    };
+    for (unsigned k = 0; k < 3; k++) {
+        painel_alerta_runtime(&a, alertas[k][0], alertas[k][1]);
+        painel_alerta(&b, alertas[k][0], alertas[k][1]);
+        if (memcmp(a.ram_buffer, b.ram_buffer, a.bufsize) != 0) {
+            divergencias++;
+            printf("DIVERGE: alerta %u\n", k);
+        }
+    }
+
+    // Histórico sintético: 21 h de amostras a 10 Hz (ondas com ruído e um buraco sem amostras)
+    static Historico h;
+    historico_init(&h, 2);
+    uint32_t semente = 1;
+    for (uint32_t k = 0; k < 21u * 3600 * 10; k++) {
+        if (k / 10 % 5000 > 4900)
+            continue;
+        uint16_t v[2];
+        semente = semente * 1103515245 + 12345;
+        int32_t onda = (int32_t)(k / 10 % 2000);
+        v[0] = (uint16_t)((onda < 1000 ? onda : 2000 - onda) * 9 / 10 + (semente >> 16) % 100);
+        v[1] = (uint16_t)(k / 10 % 1000);
+        historico_amostra(&h, k * 100000u, v);
+    }
+    for (uint8_t nivel = 0; nivel < HIST_NIVEIS; nivel++) {
+        for (uint8_t canal = 0; canal < 2; canal++) {
+            memset(b.ram_buffer + 1, 0xA5, b.bufsize - 1);
+            painel_grafico_runtime(&a, &t, &h, nivel, canal);
+            painel_grafico(&b, &t, &h, nivel, canal);
+            if (memcmp(a.ram_buffer, b.ram_buffer, a.bufsize) != 0) {
+                divergencias++;
+                printf("DIVERGE: gráfico nível %u canal %u\n", nivel, canal);
+            }
+        }
+    }
+    printf("conferência: %s (%d divergências)\n", divergencias ? "FALHOU" : "ok", divergencias);
+
+    // Custo por quadro
+    double t0 = agora_ns();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (int v = 0; v <= CANAIS_ESCALA; v += 10) {
+            d.valor[0] = d.valor[1] = (uint16_t)v;
+            painel_dashboard_runtime(&a, &t, &d, 0);
+        }
+    }
+    double runtime = (agora_ns() - t0) / (REPETICOES * 101.0);
+
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (int v = 0; v <= CANAIS_ESCALA; v += 10) {
+            d.valor[0] = d.valor[1] = (uint16_t)v;
+            painel_dashboard(&b, &t, &d, 0);
+        }
+    }
+    double rapido = (agora_ns() - t0) / (REPETICOES * 101.0);
+
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES * 30; r++)
+        painel_alerta_runtime(&a, alertas[r % 3][0], alertas[r % 3][1]);
+    double alerta_runtime = (agora_ns() - t0) / (REPETICOES * 30.0);
+
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES * 30; r++)
+        painel_alerta(&b, alertas[r % 3][0], alertas[r % 3][1]);
+    double alerta_rapido = (agora_ns() - t0) / (REPETICOES * 30.0);
+
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES * 3; r++)
+        painel_grafico_runtime(&a, &t, &h, r % HIST_NIVEIS, 0);
+    double grafico_runtime = (agora_ns() - t0) / (REPETICOES * 3.0);
+
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES * 3; r++)
+        painel_grafico(&b, &t, &h, r % HIST_NIVEIS, 0);
+    double grafico_rapido = (agora_ns() - t0) / (REPETICOES * 3.0);
+
+    // Custo de uma amostra no histórico (inclui os fechamentos de balde)
+    t0 = agora_ns();
+    const uint32_t amostras = 10000000;
+    for (uint32_t k = 0; k < amostras; k++) {
+        uint16_t v[2] = {(uint16_t)(k % 1000), (uint16_t)(k % 777)};
+        historico_amostra(&h, k * 100000u, v);
+    }
+    double por_amostra = (agora_ns() - t0) / amostras;
+
+    printf("%-10s %14s %14s %8s\n", "tela", "runtime ns", "assets ns", "ganho");
+    printf("%-10s %14.0f %14.0f %7.1fx\n", "painel", runtime, rapido, runtime / rapido);
+    printf("%-10s %14.0f %14.0f %7.1fx\n", "alerta", alerta_runtime, alerta_rapido, alerta_runtime / alerta_rapido);
+    printf("%-10s %14.0f %14.0f %7.1fx  (trechos verticais)\n", "grafico", grafico_runtime, grafico_rapido,
+           grafico_runtime / grafico_rapido);
+    printf("histórico: %.1f ns por amostra, %zu bytes\n", por_amostra, sizeof(Historico));
+    return divergencias != 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * Envia um comando de configuração para a estação pela USB CDC
+ *
+ * Monta a lista de itens com lib/config.c, enquadra como a telemetria
+ * (CRC-16 + COBS + 0x00) e espera o registro TELEM_CONFIG de resposta no
+ * meio do fluxo de telemetria. Sem itens, só consulta a versão ativa. Com
+ * "-" no lugar da porta o quadro vai para a saída padrão.
+ *
+ *   tools/bin/config_estacao -a 20 -l 0:450:850 /dev/ttyACM0
+ *   tools/bin/config_estacao -s alerta:3000:60:40:10 /dev/ttyACM0
+ *   tools/bin/config_estacao /dev/ttyACM0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include "config.h"
+#include "telemetria.h"
+
+#define ESPERA_MS 2000
+
+static uint32_t ler_u32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+static double agora_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+static int uso(const char *nome) {
+    fprintf(stderr,
+            "uso: %s [-a hz] [-l canal:atencao:alerta]... [-s atencao|alerta:f1[,f2,f3]:tom_ms:pausa_ms:repeticoes]\n"
+            "          <porta|->\n"
+            "limiares em permil; sem opções só consulta a versão ativa\n", nome);
+    return 2;
+}
+
+/**
+ * Lê "f1[,f2,f3]:tom_ms:pausa_ms:repeticoes"
+ */
+static int ler_som(const char *texto, Padrao_buzzer *som) {
+    unsigned f[CONFIG_TONS_MAX] = {0}, tom, pausa, rep;
+    char freqs[64];
+
+    if (sscanf(texto, "%63[0-9,]:%u:%u:%u", freqs, &tom, &pausa, &rep) != 4)
+        return -1;
+    int tons = sscanf(freqs, "%u,%u,%u", &f[0], &f[1], &f[2]);
+    if (tons < 1)
+        return -1;
+
+    som->tons = (uint8_t)tons;
+    som->repeticoes = (uint8_t)rep;
+    som->tom_ms = (uint16_t)tom;
+    som->pausa_ms = (uint16_t)pausa;
+    for (int k = 0; k < CONFIG_TONS_MAX; k++)
+        som->freq_hz[k] = (uint16_t)f[k];
+    return 0;
+}
+
+static void configurar_serial(int fd) {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) != 0)
+        return;
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+/**
+ * Procura a resposta no fluxo de telemetria; retorna o resultado ou -1 sem resposta
+ */
+static int esperar_resposta(int fd) {
+    uint8_t entrada[512], bloco[TELEM_QUADRO_MAX + 1], r[TELEM_QUADRO_MAX];
+    size_t n_bloco = 0;
+    double limite = agora_ms() + ESPERA_MS;
+
+    while (agora_ms() < limite) {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0)
+            continue;
+        ssize_t lidos = read(fd, entrada, sizeof(entrada));
+        if (lidos <= 0)
+            return -1;
+
+        for (ssize_t i = 0; i < lidos; i++) {
+            if (entrada[i] != 0) {
+                if (n_bloco < sizeof(bloco))
+                    bloco[n_bloco] = entrada[i];
+                n_bloco++;
+                continue;
+            }
+            size_t m = n_bloco <= sizeof(bloco) ? cobs_decodificar(bloco, n_bloco, r) : 0;
+            n_bloco = 0;
+            if (m < TELEM_CABECALHO + 2 + 16 || r[0] != TELEM_CONFIG ||
+                telemetria_crc16(r, m - 2) != (uint16_t)(r[m - 2] | r[m - 1] << 8))
+                continue;
+
+            static const char *const resultados[] = {"ok", "formato", "faixa", "ocupada", "crc"};
+            uint32_t res = ler_u32(&r[7]);
+            printf("%s: versao=%u amostragem=%uHz gravada=%s\n",
+                   res < sizeof(resultados) / sizeof(resultados[0]) ? resultados[res] : "?",
+                   ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]) ? "sim" : "nao");
+            return (int)res;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv) {
+    uint8_t itens[CONFIG_ITENS_MAX + 2];
+    uint8_t *p = itens;
+    const char *caminho = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        // Cada item cabe em 12 bytes; o limite vale para o comando inteiro
+        if (p - itens > CONFIG_ITENS_MAX - 12) {
+            fprintf(stderr, "comando maior que %d bytes\n", CONFIG_ITENS_MAX);
+            return 2;
+        }
+        if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            p = config_item_amostragem(p, (uint16_t)atoi(argv[++i]));
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            unsigned canal, atencao, alerta;
+            if (sscanf(argv[++i], "%u:%u:%u", &canal, &atencao, &alerta) != 3)
+                return uso(argv[0]);
+            p = config_item_limiares(p, (uint8_t)canal, (uint16_t)atencao, (uint16_t)alerta);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            Padrao_buzzer som;
+            const char *arg = argv[++i];
+            ItemConfig item;
+            if (strncmp(arg, "atencao:", 8) == 0)
+                item = CONFIG_ITEM_SOM_ATENCAO;
+            else if (strncmp(arg, "alerta:", 7) == 0)
+                item = CONFIG_ITEM_SOM_ALERTA;
+            else
+                return uso(argv[0]);
+            if (ler_som(strchr(arg, ':') + 1, &som) != 0)
+                return uso(argv[0]);
+            p = config_item_som(p, item, &som);
+        } else if (argv[i][0] != '-' || strcmp(argv[i], "-") == 0) {
+            caminho = argv[i];
+        } else {
+            return uso(argv[0]);
+        }
+    }
+    if (caminho == NULL)
+        return uso(argv[0]);
+
+    // Quadro: itens + CRC-16 em COBS, terminado por 0x00
+    size_t n = (size_t)(p - itens);
+    uint16_t crc = telemetria_crc16(itens, n);
+    itens[n++] = (uint8_t)crc;
+    itens[n++] = (uint8_t)(crc >> 8);
+    uint8_t quadro[CONFIG_ITENS_MAX + 8];
+    size_t tamanho = cobs_codificar(itens, n, quadro);
+    quadro[tamanho++] = 0x00;
+
+    if (strcmp(caminho, "-") == 0)
+        return fwrite(quadro, 1, tamanho, stdout) != tamanho;
+
+    int fd = open(caminho, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        perror(caminho);
+        return 1;
+    }
+    configurar_serial(fd);
+    tcflush(fd, TCIFLUSH);
+
+    if (write(fd, quadro, tamanho) != (ssize_t)tamanho) {
+        perror("write");
+        return 1;
+    }
+
+    int resultado = esperar_resposta(fd);
+    if (resultado < 0)
+        fprintf(stderr, "sem resposta em %d ms\n", ESPERA_MS);
+    close(fd);
+    return resultado != CONFIG_OK;
+}
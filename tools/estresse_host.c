@@ -0,0 +1,327 @@
+/**
+ * Modo de estresse no host: busca da maior taxa de amostragem sustentável
+ *
+ * Reproduz o conjunto de tasks do firmware com pthreads: aquisição em
+ * disparos de 1 ms com a carga sintética de lib/carga.c, display a 10 fps
+ * desenhando o painel, LEDs/matriz/buzzer como consumidores "mais recente"
+ * e a telemetria esvaziando o anel numa USB de banda limitada. As perdas
+ * são contadas como no firmware (disparos atrasados, entregas e quadros do
+ * display) e a busca dobra/bisseciona a taxa até achar o limite. O anel de
+ * telemetria cheio mede a USB, não o pipeline: sai na coluna "anel" mas
+ * não reprova a taxa.
+ *
+ * A telemetria dorme numa variável de condição sinalizada a cada registro
+ * publicado, então o anel só transborda quando o consumidor de fato não
+ * acompanha. Com -c cada amostra custa mais N ns de processamento, para
+ * conferir que o limite encontrado acompanha o custo do pipeline.
+ *
+ * O host tem vários núcleos e outro relógio, então o resultado é uma
+ * aproximação; no alvo o mesmo laço roda com -DMODO_ESTRESSE=1.
+ *
+ * Uso: tools/bin/estresse_host [-p passo_ms] [-u bytes_por_s] [-t tolerancia_ms] [-c custo_ns]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "canais.h"
+#include "telemetria.h"
+#include "painel.h"
+#include "entrega.h"
+#include "carga.h"
+#include "filtro.h"
+
+#define TICK_NS 1000000L          // Disparo do timer de aquisição (1 ms)
+#define DISPLAY_QUADRO_NS 100000000L
+#define AMOSTRAGEM_HZ 10
+
+static Tabela_canais canais;
+static Gerador_carga gerador;
+static Anel_telemetria anel;
+static Filtro filtro;
+static Entrega entrega_display, entrega_leds, entrega_matriz, entrega_buzzer;
+
+static atomic_uint taxa_hz = AMOSTRAGEM_HZ;
+static atomic_uint amostras, atrasos, display_perdidos;
+static atomic_int rodando = 1;
+static long usb_bytes_s = 1000000;   // Vazão simulada da USB CDC (0 = sem limite)
+static long tolerancia_ticks = 50;   // Atraso do escalonador do host tolerado (ms)
+static long custo_extra_ns = 0;      // Processamento adicional por amostra
+
+// Aviso de registro novo no anel para a thread de telemetria
+static pthread_mutex_t anel_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t anel_cond = PTHREAD_COND_INITIALIZER;
+static int anel_pendente;
+static atomic_int telemetria_dormindo;
+
+static uint32_t agora_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void somar_ns(struct timespec *t, long ns) {
+    t->tv_nsec += ns;
+    while (t->tv_nsec >= 1000000000L) {
+        t->tv_sec++;
+        t->tv_nsec -= 1000000000L;
+    }
+}
+
+static long decorrido_ns(const struct timespec *de, const struct timespec *ate) {
+    return (ate->tv_sec - de->tv_sec) * 1000000000L + (ate->tv_nsec - de->tv_nsec);
+}
+
+static void avisar_telemetria(void) {
+    atomic_thread_fence(memory_order_seq_cst); // Publicação visível antes de olhar o flag
+    if (!atomic_load(&telemetria_dormindo))
+        return;
+    pthread_mutex_lock(&anel_mutex);
+    anel_pendente = 1;
+    pthread_cond_signal(&anel_cond);
+    pthread_mutex_unlock(&anel_mutex);
+}
+
+/**
+ * Espera registro novo; volta no máximo em 100 ms para conferir o fim.
+ * Confere o anel de novo depois de se declarar dormindo, para não perder
+ * um registro publicado entre a retirada que falhou e a espera.
+ */
+static void esperar_telemetria(void) {
+    struct timespec limite;
+    clock_gettime(CLOCK_REALTIME, &limite);
+    somar_ns(&limite, 100000000L);
+    pthread_mutex_lock(&anel_mutex);
+    atomic_store(&telemetria_dormindo, 1);
+    while (!anel_pendente && telemetria_pendentes(&anel) == 0 && atomic_load(&rodando)) {
+        if (pthread_cond_timedwait(&anel_cond, &anel_mutex, &limite) != 0)
+            break;
+    }
+    atomic_store(&telemetria_dormindo, 0);
+    anel_pendente = 0;
+    pthread_mutex_unlock(&anel_mutex);
+}
+
+static uint16_t ler_carga(uint8_t entrada) {
+    return carga_amostra(&gerador, entrada);
+}
+
+static void processar_amostra(Dados_analogicos *d, uint8_t *estado_anterior) {
+    d->instante_us = agora_us();
+    canais_adquirir(&canais, d->bruto);
+    filtro_aplicar(&filtro, d->bruto, canais.n);
+    canais_processar(&canais, d);
+
+    telemetria_publicar_amostra(&anel, d);
+    for (uint8_t i = 0; i < d->n; i++) {
+        if (d->estado[i] != estado_anterior[i]) {
+            telemetria_publicar_evento(&anel, d->instante_us, i, estado_anterior[i], d->estado[i], d->valor[i]);
+            estado_anterior[i] = d->estado[i];
+        }
+    }
+    avisar_telemetria();
+
+    if (custo_extra_ns > 0) {
+        struct timespec inicio, agora;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        do {
+            clock_gettime(CLOCK_MONOTONIC, &agora);
+        } while (decorrido_ns(&inicio, &agora) < custo_extra_ns);
+    }
+
+    entrega_enviar(&entrega_display, d);
+    entrega_enviar(&entrega_leds, d);
+    entrega_enviar(&entrega_matriz, d);
+    entrega_enviar(&entrega_buzzer, d);
+    atomic_fetch_add(&amostras, 1);
+    carga_avancar(&gerador);
+}
+
+/**
+ * Aquisição: como o timer do firmware, mas os disparos atrasados até a
+ * tolerância são recuperados (o escalonador do host não é de tempo real)
+ */
+static void *aquisicao(void *arg) {
+    Dados_analogicos d;
+    uint8_t estado_anterior[CANAIS_MAX] = {ESTADO_NORMAL};
+    uint32_t acumulado_q16 = 0;
+    struct timespec proximo;
+    clock_gettime(CLOCK_MONOTONIC, &proximo);
+
+    while (atomic_load(&rodando)) {
+        somar_ns(&proximo, TICK_NS);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &proximo, NULL);
+
+        // Disparos vencidos desde o último (1 se a thread acompanhou)
+        struct timespec agora;
+        clock_gettime(CLOCK_MONOTONIC, &agora);
+        long disparos = 1 + decorrido_ns(&proximo, &agora) / TICK_NS;
+        uint32_t hz = atomic_load(&taxa_hz);
+        uint32_t por_disparo_q16 = (uint32_t)(((uint64_t)hz << 16) / 1000);
+        if (disparos > tolerancia_ticks) {
+            atomic_fetch_add(&atrasos, (disparos - tolerancia_ticks) * ((por_disparo_q16 + 0xFFFF) >> 16));
+            disparos = tolerancia_ticks;
+        }
+        somar_ns(&proximo, (disparos - 1) * TICK_NS);
+
+        for (long k = 0; k < disparos; k++) {
+            acumulado_q16 += por_disparo_q16;
+            uint32_t n = acumulado_q16 >> 16;
+            acumulado_q16 &= 0xFFFF;
+            for (uint32_t i = 0; i < n; i++)
+                processar_amostra(&d, estado_anterior);
+        }
+    }
+    return NULL;
+}
+
+static void *display(void *arg) {
+    ssd1306_t ssd;
+    Dados_analogicos d = {0};
+    struct timespec despertar;
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &despertar);
+
+    while (atomic_load(&rodando)) {
+        entrega_receber(&entrega_display, &d, 0);
+        painel_dashboard(&ssd, &canais, &d, 0);
+        ssd1306_send_data(&ssd);
+
+        somar_ns(&despertar, DISPLAY_QUADRO_NS);
+        struct timespec agora;
+        clock_gettime(CLOCK_MONOTONIC, &agora);
+        long atraso = decorrido_ns(&despertar, &agora);
+        if (atraso >= 0) {
+            // Quadro estourou o período: conta e pula os perdidos
+            long perdidos = atraso / DISPLAY_QUADRO_NS + 1;
+            atomic_fetch_add(&display_perdidos, perdidos);
+            somar_ns(&despertar, perdidos * DISPLAY_QUADRO_NS);
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &despertar, NULL);
+    }
+    return NULL;
+}
+
+// LEDs, matriz e buzzer: reagem à amostra mais recente e seguram a saída
+static void *consumidor(void *arg) {
+    Entrega *e = arg;
+    Dados_analogicos d;
+    while (atomic_load(&rodando)) {
+        if (entrega_receber(e, &d, pdMS_TO_TICKS(100)))
+            usleep(50000);
+    }
+    return NULL;
+}
+
+/**
+ * Telemetria: enquadra cada registro e "envia" no ritmo da USB simulada
+ */
+static void *telemetria(void *arg) {
+    Registro_telemetria registro;
+    uint8_t quadro[TELEM_QUADRO_MAX];
+    uint16_t seq = 0;
+    double credito = 0;   // Bytes que a USB ainda aceita neste instante
+    struct timespec antes, agora;
+    clock_gettime(CLOCK_MONOTONIC, &antes);
+
+    while (atomic_load(&rodando)) {
+        if (!telemetria_retirar(&anel, &registro)) {
+            esperar_telemetria();
+            continue;
+        }
+        size_t tamanho = telemetria_quadro(registro.dados, registro.tamanho, seq++, quadro);
+        if (usb_bytes_s == 0)
+            continue;
+        for (;;) {
+            clock_gettime(CLOCK_MONOTONIC, &agora);
+            credito += decorrido_ns(&antes, &agora) * 1e-9 * usb_bytes_s;
+            antes = agora;
+            if (credito > usb_bytes_s / 100.0)
+                credito = usb_bytes_s / 100.0; // Buffer da USB: ~10 ms de dados
+            if (credito >= tamanho)
+                break;
+            usleep(100);
+        }
+        credito -= tamanho;
+    }
+    return NULL;
+}
+
+static uint32_t perdas_pipeline(void) {
+    return atomic_load(&atrasos) +
+           entrega_perdas(&entrega_display) + entrega_perdas(&entrega_leds) +
+           entrega_perdas(&entrega_matriz) + entrega_perdas(&entrega_buzzer) +
+           atomic_load(&display_perdidos);
+}
+
+int main(int argc, char **argv) {
+    long passo_ms = 1000;
+    int opt;
+    while ((opt = getopt(argc, argv, "p:u:t:c:")) != -1) {
+        switch (opt) {
+            case 'p': passo_ms = atol(optarg); break;
+            case 'u': usb_bytes_s = atol(optarg); break;
+            case 't': tolerancia_ticks = atol(optarg) > 0 ? atol(optarg) : 1; break;
+            case 'c': custo_extra_ns = atol(optarg); break;
+            default:
+                fprintf(stderr, "uso: %s [-p passo_ms] [-u bytes_por_s] [-t tolerancia_ms] [-c custo_ns]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    canais_init(&canais);
+    canais_registrar_leitor(&canais, FONTE_ADC, ler_carga);
+    canais_adicionar(&canais, "CHUVA", "CHUVA INTENSA", FONTE_ADC, 1, 0, 4088, 400, 800);
+    canais_adicionar(&canais, "NIVEL", "NIVEL ELEVADO", FONTE_ADC, 0, 0, 4088, 400, 700);
+    carga_init(&gerador, 1);
+    telemetria_init(&anel);
+    filtro_init(&filtro);
+    for (uint8_t i = 0; i < canais.n; i++)
+        filtro_configurar(&filtro, i, FILTRO_HAMPEL, 0);
+    entrega_criar(&entrega_display, "display", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_leds, "leds", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_matriz, "matriz", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+    entrega_criar(&entrega_buzzer, "buzzer", ENTREGA_MAIS_RECENTE, 1, sizeof(Dados_analogicos));
+
+    pthread_t threads[6];
+    pthread_create(&threads[0], NULL, aquisicao, NULL);
+    pthread_create(&threads[1], NULL, display, NULL);
+    pthread_create(&threads[2], NULL, consumidor, &entrega_leds);
+    pthread_create(&threads[3], NULL, consumidor, &entrega_matriz);
+    pthread_create(&threads[4], NULL, consumidor, &entrega_buzzer);
+    pthread_create(&threads[5], NULL, telemetria, NULL);
+
+    printf("USB simulada: %ld B/s, passo de %ld ms, custo extra %ld ns/amostra\n",
+           usb_bytes_s, passo_ms, custo_extra_ns);
+    printf("%10s %10s %10s %10s %10s %10s\n", "taxa_hz", "amostras", "atrasos", "anel", "display", "maior_ok");
+
+    Busca_taxa busca;
+    busca_iniciar(&busca, AMOSTRAGEM_HZ, CARGA_ADC_MAX_HZ);
+    while (!busca.concluida) {
+        uint32_t taxa = busca.taxa_hz;
+        atomic_store(&taxa_hz, taxa);
+        usleep(100000); // Acomoda a taxa nova antes de medir
+
+        uint32_t a0 = atomic_load(&amostras), p0 = perdas_pipeline();
+        uint32_t atr0 = atomic_load(&atrasos), anel0 = anel.descartados, disp0 = atomic_load(&display_perdidos);
+        usleep(passo_ms * 1000);
+        uint32_t p = perdas_pipeline() - p0;
+        busca_registrar(&busca, p);
+
+        printf("%10u %10u %10u %10u %10u %10u\n", taxa, atomic_load(&amostras) - a0,
+               atomic_load(&atrasos) - atr0, anel.descartados - anel0,
+               atomic_load(&display_perdidos) - disp0, busca.maior_ok);
+        fflush(stdout);
+    }
+
+    atomic_store(&rodando, 0);
+    for (int i = 0; i < 6; i++)
+        pthread_join(threads[i], NULL);
+
+    printf("maior taxa sustentável: %u Hz (%u canais)\n", busca.maior_ok, canais.n);
+    return 0;
+}
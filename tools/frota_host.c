@@ -0,0 +1,525 @@
+/**
+ * Simulador de frota: muitas estações independentes no host
+ *
+ * Cada estação tem a própria tabela de canais, filtro, histórico, anel de
+ * telemetria e estado de alerta, e roda o mesmo pipeline do firmware
+ * (aquisição -> filtro -> calibração/classificação -> histórico ->
+ * telemetria). A entrada de cada estação é um traço gravado (CSV com
+ * leituras brutas "chuva,nivel[,rio]" por amostra) ou um hidrograma
+ * sintético: uma chuva que desce a bacia e um nível que responde como
+ * reservatório linear, com atraso crescente rio abaixo.
+ *
+ * O tempo simulado avança em épocas; em cada época toda estação processa
+ * as amostras do intervalo. As estações de uma época são distribuídas em
+ * blocos contíguos entre as threads, cada uma com sua deque: o dono tira
+ * do fim, e quem fica sem trabalho rouba do início da deque de outra.
+ * Estações de referência amostram mais rápido, então os blocos não custam
+ * o mesmo e o roubo equilibra a carga.
+ *
+ * Ao fim, mede amostras-estação por segundo para cada número de threads e
+ * a aceleração em relação a 1 thread; linhas com mais threads que núcleos
+ * saem marcadas, pois ali não há aceleração a esperar.
+ *
+ *   tools/bin/frota_host -n 512 -d 6 -j 1,2,4,8
+ *   tools/bin/frota_host -t tracos/ -n 32
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "canais.h"
+#include "filtro.h"
+#include "historico.h"
+#include "telemetria.h"
+
+#define THREADS_MAX 64
+#define ESTACOES_MAX 65536
+#define EPOCA_S 60                // Tempo simulado por época
+#define GIROS_OCIOSO 64           // Tentativas sem trabalho antes de ceder o núcleo
+#define ESPERA_OCIOSO_MAX_US 64   // Teto do recuo exponencial depois de ceder
+#define TAXA_HZ 10                // Estações comuns
+#define TAXA_REFERENCIA_HZ 50     // Uma em cada REFERENCIA_A_CADA estações
+#define REFERENCIA_A_CADA 8
+#define RUIDO 24                  // Amplitude do ruído nas leituras (contagens)
+#define PICOS_POR_MIL 2           // Leituras espúrias por mil amostras
+#define ESCALA_BRUTA 4088         // Fundo de escala do ADC cadastrado nos canais
+
+// Hidrograma sintético, em minutos simulados
+#define CHUVA_INICIO_MIN 60
+#define CHUVA_DURACAO_MIN 90
+#define CHUVA_DESLOCAMENTO_MIN 60 // Atraso da chuva da cabeceira à foz
+#define NIVEL_ATRASO_MIN 120      // Atraso da onda de cheia da cabeceira à foz
+#define NIVEL_TAU_MIN 40          // Constante de tempo do reservatório linear
+
+typedef struct {
+    uint16_t *leituras;           // canais leituras por amostra
+    uint32_t amostras;
+} Traco;
+
+typedef struct {
+    Tabela_canais canais;
+    Filtro filtro;
+    Historico historico;
+    Anel_telemetria anel;
+
+    uint32_t taxa_hz;
+    uint64_t amostra;             // Próxima amostra (tempo simulado = amostra / taxa_hz)
+    uint8_t estado_anterior[CANAIS_MAX];
+    uint8_t estado_global;
+
+    // Entrada
+    const Traco *traco;           // NULL: hidrograma sintético
+    double posicao;               // 0 = cabeceira, 1 = foz
+    double intensidade;           // Chuva local relativa
+    double nivel;                 // Estado do reservatório (permil)
+    double rio;                   // Segundo ponto de nível, mais lento
+    uint32_t semente;
+    uint16_t leitura[CANAIS_MAX]; // Leituras da amostra atual, entregues pelo leitor
+
+    // Resultados
+    uint32_t eventos;
+    uint32_t quadros;
+    uint64_t bytes;
+    int32_t primeiro_alerta_min;  // -1 se nunca entrou em alerta
+} Estacao;
+
+typedef struct {
+    uint32_t *itens;
+    uint32_t inicio, fim;         // Roubo no início, dono no fim
+    pthread_mutex_t trava;
+} Deque;
+
+typedef struct {
+    int id;
+    uint32_t semente;
+    uint64_t roubos;
+} Trabalhador;
+
+static Estacao *estacoes;
+static uint32_t n_estacoes = 256;
+static uint32_t n_epocas;
+static int n_threads;
+static Deque deques[THREADS_MAX];
+static Trabalhador trabalhadores[THREADS_MAX];
+static pthread_barrier_t barreira;
+static atomic_uint restantes;     // Estações da época ainda não processadas
+static uint32_t epoca;
+static uint32_t (*linha_tempo)[2]; // Estações em atenção e em alerta ao fim de cada época
+static bool quadros_ativos = true;
+
+static __thread Estacao *estacao_atual;
+
+static double agora_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t aleatorio(uint32_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Leitor das fontes simuladas: devolve a leitura já gerada para a estação da thread
+static uint16_t ler_estacao(uint8_t entrada) {
+    return estacao_atual->leitura[entrada];
+}
+
+/**
+ * Chuva da estação no minuto t (permil): pulso suave que chega mais
+ * tarde rio abaixo
+ */
+static double chuva_em(const Estacao *e, double t_min) {
+    double x = (t_min - CHUVA_INICIO_MIN - e->posicao * CHUVA_DESLOCAMENTO_MIN) / CHUVA_DURACAO_MIN;
+    if (x <= 0 || x >= 1)
+        return 0;
+    double v = 4 * x * (1 - x);
+    return 1000 * e->intensidade * v * v;
+}
+
+static uint16_t para_bruto(Estacao *e, double permil) {
+    int v = (int)(permil * ESCALA_BRUTA / CANAIS_ESCALA);
+    v += (int)(aleatorio(&e->semente) % (2 * RUIDO + 1)) - RUIDO;
+    if (aleatorio(&e->semente) % 1000 < PICOS_POR_MIL)
+        v = (int)(aleatorio(&e->semente) % ESCALA_BRUTA);
+    return (uint16_t)(v < 0 ? 0 : v > ESCALA_BRUTA ? ESCALA_BRUTA : v);
+}
+
+static void gerar_leituras(Estacao *e) {
+    if (e->traco != NULL) {
+        const uint16_t *l = &e->traco->leituras[(e->amostra % e->traco->amostras) * e->canais.n];
+        memcpy(e->leitura, l, e->canais.n * sizeof(uint16_t));
+        return;
+    }
+
+    double t_min = (double)e->amostra / e->taxa_hz / 60;
+    double passo_min = 1.0 / e->taxa_hz / 60;
+    double chuva = chuva_em(e, t_min);
+
+    // O nível responde à chuva de montante, chegando com atraso rio abaixo
+    double afluente = 0.85 * chuva_em(e, t_min - e->posicao * NIVEL_ATRASO_MIN);
+    e->nivel += (afluente - e->nivel) * passo_min / NIVEL_TAU_MIN;
+    e->rio += (e->nivel - e->rio) * passo_min / (2 * NIVEL_TAU_MIN);
+
+    e->leitura[0] = para_bruto(e, chuva);
+    e->leitura[1] = para_bruto(e, 150 + e->nivel);
+    if (e->canais.n > 2)
+        e->leitura[2] = para_bruto(e, 150 + e->rio);
+}
+
+/**
+ * Uma amostra do pipeline da estação, como Processar_amostra no firmware
+ */
+static void processar_amostra(Estacao *e) {
+    Dados_analogicos d;
+    Registro_telemetria registro;
+    uint8_t quadro[TELEM_QUADRO_MAX];
+
+    gerar_leituras(e);
+    d.instante_us = (uint32_t)(e->amostra * 1000000 / e->taxa_hz);
+    canais_adquirir(&e->canais, d.bruto);
+    filtro_aplicar(&e->filtro, d.bruto, e->canais.n);
+    canais_processar(&e->canais, &d);
+    historico_amostra(&e->historico, d.instante_us, d.valor);
+
+    telemetria_publicar_amostra(&e->anel, &d);
+    for (uint8_t i = 0; i < d.n; i++) {
+        if (d.estado[i] != e->estado_anterior[i]) {
+            telemetria_publicar_evento(&e->anel, d.instante_us, i, e->estado_anterior[i], d.estado[i], d.valor[i]);
+            e->estado_anterior[i] = d.estado[i];
+            e->eventos++;
+        }
+    }
+    if (d.estado_global == ESTADO_ALERTA && e->primeiro_alerta_min < 0)
+        e->primeiro_alerta_min = (int32_t)(e->amostra / e->taxa_hz / 60);
+    e->estado_global = d.estado_global;
+
+    // Enlace: enquadra o que a estação enviaria
+    while (telemetria_retirar(&e->anel, &registro)) {
+        if (quadros_ativos)
+            e->bytes += telemetria_quadro(registro.dados, registro.tamanho, (uint16_t)e->quadros, quadro);
+        e->quadros++;
+    }
+    e->amostra++;
+}
+
+static void processar_epoca(Estacao *e) {
+    uint64_t fim = (uint64_t)(epoca + 1) * EPOCA_S * e->taxa_hz;
+    estacao_atual = e;
+    while (e->amostra < fim)
+        processar_amostra(e);
+}
+
+/**
+ * Carrega <pasta>/<indice>.csv; retorna NULL se não existir
+ */
+static Traco *carregar_traco(const char *pasta, uint32_t indice, uint8_t canais) {
+    char caminho[512];
+    snprintf(caminho, sizeof(caminho), "%s/%u.csv", pasta, indice);
+    FILE *f = fopen(caminho, "r");
+    if (f == NULL)
+        return NULL;
+
+    Traco *t = calloc(1, sizeof(*t));
+    uint32_t capacidade = 0;
+    char linha[128];
+    while (fgets(linha, sizeof(linha), f) != NULL) {
+        unsigned v[3] = {0};
+        if (sscanf(linha, "%u,%u,%u", &v[0], &v[1], &v[2]) < 2)
+            continue; // Cabeçalho ou linha inválida
+        if (t->amostras == capacidade) {
+            capacidade = capacidade ? capacidade * 2 : 1024;
+            t->leituras = realloc(t->leituras, (size_t)capacidade * canais * sizeof(uint16_t));
+        }
+        for (uint8_t c = 0; c < canais; c++)
+            t->leituras[t->amostras * canais + c] = (uint16_t)(v[c] > ESCALA_BRUTA ? ESCALA_BRUTA : v[c]);
+        t->amostras++;
+    }
+    fclose(f);
+    if (t->amostras == 0) {
+        free(t->leituras);
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+static void iniciar_estacao(Estacao *e, uint32_t i, Traco *traco) {
+    memset(e, 0, sizeof(*e));
+    e->semente = 2463534242u ^ (i * 2654435761u);
+    e->posicao = n_estacoes > 1 ? (double)i / (n_estacoes - 1) : 0;
+    e->intensidade = 0.6 + (aleatorio(&e->semente) % 800) / 1000.0;
+    e->taxa_hz = i % REFERENCIA_A_CADA == 0 ? TAXA_REFERENCIA_HZ : TAXA_HZ;
+    e->traco = traco;
+    e->primeiro_alerta_min = -1;
+
+    canais_init(&e->canais);
+    canais_registrar_leitor(&e->canais, FONTE_SIMULADA, ler_estacao);
+    canais_adicionar(&e->canais, "CHUVA", "CHUVA INTENSA", FONTE_SIMULADA, 0, 0, ESCALA_BRUTA, 400, 800);
+    canais_adicionar(&e->canais, "NIVEL", "NIVEL ELEVADO", FONTE_SIMULADA, 1, 0, ESCALA_BRUTA, 400, 700);
+    // Estações rio abaixo têm um segundo ponto de nível
+    if (i % 3 == 2)
+        canais_adicionar(&e->canais, "RIO", "RIO TRANSBORDANDO", FONTE_SIMULADA, 2, 0, ESCALA_BRUTA, 450, 750);
+
+    filtro_init(&e->filtro);
+    for (uint8_t c = 0; c < e->canais.n; c++)
+        filtro_configurar(&e->filtro, c, FILTRO_HAMPEL, 0);
+    historico_init(&e->historico, e->canais.n < HIST_CANAIS ? e->canais.n : HIST_CANAIS);
+    telemetria_init(&e->anel);
+}
+
+static bool tirar_proprio(Deque *d, uint32_t *estacao) {
+    bool ok = false;
+    pthread_mutex_lock(&d->trava);
+    if (d->fim > d->inicio) {
+        *estacao = d->itens[--d->fim];
+        ok = true;
+    }
+    pthread_mutex_unlock(&d->trava);
+    return ok;
+}
+
+static bool roubar(Deque *d, uint32_t *estacao) {
+    bool ok = false;
+    if (pthread_mutex_trylock(&d->trava) != 0)
+        return false; // Disputada: tenta outra vítima
+    if (d->fim > d->inicio) {
+        *estacao = d->itens[d->inicio++];
+        ok = true;
+    }
+    pthread_mutex_unlock(&d->trava);
+    return ok;
+}
+
+/**
+ * Blocos contíguos por thread; a ordem da deque faz o dono começar pelo
+ * fim do bloco e os ladrões pelo início
+ */
+static void distribuir_epoca(void) {
+    for (int w = 0; w < n_threads; w++) {
+        Deque *d = &deques[w];
+        uint32_t de = (uint32_t)((uint64_t)n_estacoes * w / n_threads);
+        uint32_t ate = (uint32_t)((uint64_t)n_estacoes * (w + 1) / n_threads);
+        d->inicio = 0;
+        d->fim = 0;
+        for (uint32_t i = de; i < ate; i++)
+            d->itens[d->fim++] = i;
+    }
+    atomic_store(&restantes, n_estacoes);
+}
+
+static void fechar_epoca(void) {
+    uint32_t atencao = 0, alerta = 0;
+    for (uint32_t i = 0; i < n_estacoes; i++) {
+        atencao += estacoes[i].estado_global == ESTADO_ATENCAO;
+        alerta += estacoes[i].estado_global == ESTADO_ALERTA;
+    }
+    linha_tempo[epoca][0] = atencao;
+    linha_tempo[epoca][1] = alerta;
+    epoca++;
+}
+
+/**
+ * Espera de quem ficou sem trabalho: gira algumas tentativas, depois cede o
+ * núcleo e, se continuar sem achar nada, dorme com recuo exponencial. Sem
+ * isso, com mais threads que núcleos, as ociosas tomam a fatia de tempo de
+ * quem ainda tem estações a processar.
+ */
+static void ociosa(uint32_t falhas) {
+    if (falhas <= GIROS_OCIOSO)
+        return;
+    if (falhas <= 2 * GIROS_OCIOSO) {
+        sched_yield();
+        return;
+    }
+    uint32_t rodada = falhas - 2 * GIROS_OCIOSO;
+    uint32_t us = rodada < 6 ? 1u << rodada : ESPERA_OCIOSO_MAX_US;
+    struct timespec espera = {0, (long)us * 1000};
+    nanosleep(&espera, NULL);
+}
+
+static void *trabalhar(void *arg) {
+    Trabalhador *t = arg;
+    uint32_t estacao;
+
+    for (;;) {
+        if (t->id == 0 && epoca < n_epocas)
+            distribuir_epoca();
+        pthread_barrier_wait(&barreira);
+        if (epoca >= n_epocas)
+            return NULL;
+
+        uint32_t falhas = 0;
+        while (atomic_load_explicit(&restantes, memory_order_acquire) > 0) {
+            bool achou = tirar_proprio(&deques[t->id], &estacao);
+            if (!achou && n_threads > 1) {
+                uint32_t vitima = aleatorio(&t->semente) % (n_threads - 1);
+                vitima += vitima >= (uint32_t)t->id;
+                achou = roubar(&deques[vitima], &estacao);
+                t->roubos += achou;
+            }
+            if (achou) {
+                processar_epoca(&estacoes[estacao]);
+                atomic_fetch_sub_explicit(&restantes, 1, memory_order_release);
+                falhas = 0;
+            } else {
+                ociosa(++falhas);
+            }
+        }
+
+        pthread_barrier_wait(&barreira);
+        if (t->id == 0)
+            fechar_epoca();
+    }
+}
+
+typedef struct {
+    double segundos;
+    uint64_t amostras;
+    uint64_t roubos;
+} Medida;
+
+static Medida simular(int threads, Traco **tracos) {
+    Medida m = {0};
+    n_threads = threads;
+    epoca = 0;
+    for (uint32_t i = 0; i < n_estacoes; i++)
+        iniciar_estacao(&estacoes[i], i, tracos[i]);
+    for (int w = 0; w < threads; w++) {
+        trabalhadores[w] = (Trabalhador){.id = w, .semente = 0x9E3779B9u * (w + 1)};
+        pthread_mutex_init(&deques[w].trava, NULL);
+    }
+    pthread_barrier_init(&barreira, NULL, (unsigned)threads);
+
+    pthread_t ids[THREADS_MAX];
+    double inicio = agora_s();
+    for (int w = 1; w < threads; w++)
+        pthread_create(&ids[w], NULL, trabalhar, &trabalhadores[w]);
+    trabalhar(&trabalhadores[0]);
+    for (int w = 1; w < threads; w++)
+        pthread_join(ids[w], NULL);
+    m.segundos = agora_s() - inicio;
+
+    pthread_barrier_destroy(&barreira);
+    for (int w = 0; w < threads; w++) {
+        pthread_mutex_destroy(&deques[w].trava);
+        m.roubos += trabalhadores[w].roubos;
+    }
+    for (uint32_t i = 0; i < n_estacoes; i++)
+        m.amostras += estacoes[i].amostra;
+    return m;
+}
+
+/**
+ * Propagação da cheia: estações em alerta ao longo do tempo e minuto do
+ * primeiro alerta por trecho da bacia
+ */
+static void relatorio_bacia(void) {
+    uint32_t passo = n_epocas / 12 ? n_epocas / 12 : 1;
+    printf("%8s %10s %10s\n", "minuto", "atencao", "alerta");
+    for (uint32_t k = passo - 1; k < n_epocas; k += passo)
+        printf("%8u %10u %10u\n", (k + 1) * EPOCA_S / 60, linha_tempo[k][0], linha_tempo[k][1]);
+
+    uint32_t trechos = n_estacoes < 5 ? n_estacoes : 5;
+    printf("\n%8s %10s %14s %10s %12s\n", "trecho", "estacoes", "1o_alerta_min", "eventos", "bytes_enlace");
+    for (uint32_t k = 0; k < trechos; k++) {
+        uint32_t de = n_estacoes * k / trechos, ate = n_estacoes * (k + 1) / trechos;
+        int32_t primeiro = -1;
+        uint64_t eventos = 0, bytes = 0;
+        for (uint32_t i = de; i < ate; i++) {
+            int32_t p = estacoes[i].primeiro_alerta_min;
+            if (p >= 0 && (primeiro < 0 || p < primeiro))
+                primeiro = p;
+            eventos += estacoes[i].eventos;
+            bytes += estacoes[i].bytes;
+        }
+        printf("%8u %10u %14d %10llu %12llu\n", k, ate - de, primeiro,
+               (unsigned long long)eventos, (unsigned long long)bytes);
+    }
+    printf("\n");
+}
+
+static int uso(const char *nome) {
+    fprintf(stderr,
+            "uso: %s [-n estacoes] [-d horas] [-j t1,t2,...] [-t pasta_tracos] [-q]\n"
+            "  -j  números de threads a medir (padrão: 1, 2, 4... até os núcleos)\n"
+            "  -t  <pasta>/<indice>.csv com leituras brutas \"chuva,nivel[,rio]\" por amostra\n"
+            "  -q  não enquadra a telemetria (só o pipeline de medição)\n", nome);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    double horas = 6;
+    const char *pasta = NULL;
+    int lista[THREADS_MAX], n_lista = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:d:j:t:q")) != -1) {
+        switch (opt) {
+            case 'n': n_estacoes = (uint32_t)atol(optarg); break;
+            case 'd': horas = atof(optarg); break;
+            case 't': pasta = optarg; break;
+            case 'q': quadros_ativos = false; break;
+            case 'j':
+                for (char *s = strtok(optarg, ","); s != NULL && n_lista < THREADS_MAX; s = strtok(NULL, ",")) {
+                    int t = atoi(s);
+                    if (t >= 1 && t <= THREADS_MAX)
+                        lista[n_lista++] = t;
+                }
+                break;
+            default:
+                return uso(argv[0]);
+        }
+    }
+    if (n_estacoes < 1 || n_estacoes > ESTACOES_MAX || horas <= 0)
+        return uso(argv[0]);
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n_lista == 0) {
+        for (int t = 1; t <= nucleos && t <= THREADS_MAX && n_lista < THREADS_MAX; t *= 2)
+            lista[n_lista++] = t;
+        if (lista[n_lista - 1] != nucleos && nucleos <= THREADS_MAX)
+            lista[n_lista++] = (int)nucleos;
+    }
+
+    n_epocas = (uint32_t)(horas * 3600 / EPOCA_S);
+    if (n_epocas < 1)
+        n_epocas = 1;
+    estacoes = calloc(n_estacoes, sizeof(Estacao));
+    linha_tempo = calloc(n_epocas, sizeof(*linha_tempo));
+    for (int w = 0; w < THREADS_MAX; w++)
+        deques[w].itens = calloc(n_estacoes, sizeof(uint32_t));
+
+    Traco **tracos = calloc(n_estacoes, sizeof(Traco *));
+    uint32_t com_traco = 0;
+    for (uint32_t i = 0; pasta != NULL && i < n_estacoes; i++) {
+        tracos[i] = carregar_traco(pasta, i, i % 3 == 2 ? 3 : 2);
+        com_traco += tracos[i] != NULL;
+    }
+
+    printf("%u estacoes (%u com traco), %.1f h simuladas em epocas de %d s, %ld nucleos\n\n",
+           n_estacoes, com_traco, horas, EPOCA_S, nucleos);
+
+    double base = 0;
+    for (int k = 0; k < n_lista; k++) {
+        Medida m = simular(lista[k], tracos);
+        double taxa = m.amostras / m.segundos;
+        if (k == 0) {
+            relatorio_bacia();
+            printf("%ld nucleos; * = mais threads que nucleos\n", nucleos);
+            printf("%8s %10s %14s %14s %12s %10s\n", "threads", "tempo_s", "amostras", "amostras/s", "aceleracao", "roubos");
+        }
+        if (lista[k] == 1 || base == 0)
+            base = taxa / lista[k];
+        printf("%7d%c %10.3f %14llu %14.0f %11.2fx %10llu\n", lista[k], lista[k] > nucleos ? '*' : ' ',
+               m.segundos, (unsigned long long)m.amostras, taxa, taxa / base, (unsigned long long)m.roubos);
+        fflush(stdout);
+    }
+    return 0;
+}
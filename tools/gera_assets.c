@@ -0,0 +1,126 @@
+/**
+ * Gerador dos elementos estáticos do display (lib/painel_assets.h)
+ *
+ * Desenha com as mesmas primitivas do firmware (ssd1306.c e a versão
+ * runtime de painel.c) e grava o resultado no layout de memória do
+ * ssd1306 (coluna a coluna, 8 páginas por coluna), pronto para memcpy:
+ *   - fundo de cada coluna do painel com o rótulo do canal
+ *   - as 11 barras (0-100%) já combinadas com o rótulo
+ *   - dígitos deslocados para a linha dos valores
+ *   - telas de alerta completas
+ *
+ * Uso: make -C tools assets
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "painel.h"
+
+#define METADE (WIDTH / CANAIS_POR_TELA)
+#define TELA (WIDTH * HEIGHT / 8)
+
+// Devem coincidir com o cadastro dos canais em Monitoramento_chuvas.c
+static const char *const rotulos[CANAIS_POR_TELA] = {"CHUVA", "NIVEL"};
+static const char *const mensagens[CANAIS_POR_TELA] = {"CHUVA INTENSA", "NIVEL ELEVADO"};
+
+static FILE *saida;
+
+static void emitir_bytes(const uint8_t *dados, size_t n, const char *recuo) {
+    for (size_t i = 0; i < n; i++) {
+        if (i % 16 == 0)
+            fprintf(saida, "%s", recuo);
+        fprintf(saida, "0x%02X,%s", dados[i], (i % 16 == 15 || i == n - 1) ? "\n" : " ");
+    }
+}
+
+static void desenhar_rotulo(ssd1306_t *ssd, uint8_t c) {
+    ssd1306_fill(ssd, false);
+    ssd1306_draw_string(ssd, rotulos[c], layout_colunas[c].rotulo_x, PAINEL_TEXTO_Y);
+}
+
+int main(int argc, char **argv) {
+    ssd1306_t ssd;
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+
+    saida = argc > 1 ? fopen(argv[1], "w") : stdout;
+    if (saida == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(saida, "// Gerado por tools/gera_assets.c - não editar (make -C tools assets)\n");
+    fprintf(saida, "#ifndef PAINEL_ASSETS_H\n#define PAINEL_ASSETS_H\n\n#include <stdint.h>\n\n");
+
+    fprintf(saida, "static const char *const PAINEL_ROTULOS[%d] = {", CANAIS_POR_TELA);
+    for (int c = 0; c < CANAIS_POR_TELA; c++)
+        fprintf(saida, "%s\"%s\"", c ? ", " : "", rotulos[c]);
+    fprintf(saida, "};\n");
+    fprintf(saida, "static const char *const PAINEL_MENSAGENS[%d] = {", CANAIS_POR_TELA);
+    for (int c = 0; c < CANAIS_POR_TELA; c++)
+        fprintf(saida, "%s\"%s\"", c ? ", " : "", mensagens[c]);
+    fprintf(saida, "};\n\n");
+
+    // Fundo de cada coluna do painel: só o rótulo
+    fprintf(saida, "// Colunas x = %d*c .. %d*c+%d, com o rótulo do canal\n", METADE, METADE, METADE - 1);
+    fprintf(saida, "static const uint8_t PAINEL_FUNDO[%d][%d] = {\n", CANAIS_POR_TELA, METADE * 8);
+    for (int c = 0; c < CANAIS_POR_TELA; c++) {
+        desenhar_rotulo(&ssd, c);
+        fprintf(saida, "  {\n");
+        emitir_bytes(&ssd.ram_buffer[1 + c * METADE * 8], METADE * 8, "    ");
+        fprintf(saida, "  },\n");
+    }
+    fprintf(saida, "};\n\n");
+
+    // Barras: rótulo + barra com 0..10 segmentos, só as colunas da barra
+    fprintf(saida, "// Colunas da barra (x = barra_x..barra_x+%d) para 0..%d segmentos\n", BARRA_LARGURA - 1, BARRA_SEGMENTOS);
+    fprintf(saida, "static const uint8_t PAINEL_BARRAS[%d][%d][%d] = {\n", CANAIS_POR_TELA, BARRA_SEGMENTOS + 1, BARRA_LARGURA * 8);
+    for (int c = 0; c < CANAIS_POR_TELA; c++) {
+        fprintf(saida, "  {\n");
+        for (int s = 0; s <= BARRA_SEGMENTOS; s++) {
+            desenhar_rotulo(&ssd, c);
+            painel_barra(&ssd, layout_colunas[c].barra_x, (uint16_t)(s * 100));
+            fprintf(saida, "    {\n");
+            emitir_bytes(&ssd.ram_buffer[1 + (layout_colunas[c].barra_x << 3)], BARRA_LARGURA * 8, "      ");
+            fprintf(saida, "    },\n");
+        }
+        fprintf(saida, "  },\n");
+    }
+    fprintf(saida, "};\n\n");
+
+    // Dígitos: 8 colunas x (página de PAINEL_TEXTO_Y, página seguinte)
+    fprintf(saida, "// Dígitos 0-9 na linha %d: pares (página %d, página %d) por coluna\n",
+            PAINEL_TEXTO_Y, PAINEL_TEXTO_Y >> 3, (PAINEL_TEXTO_Y >> 3) + 1);
+    fprintf(saida, "static const uint8_t PAINEL_DIGITOS[10][16] = {\n");
+    for (int d = 0; d < 10; d++) {
+        uint8_t g[16];
+        ssd1306_fill(&ssd, false);
+        ssd1306_draw_char(&ssd, (char)('0' + d), 0, PAINEL_TEXTO_Y);
+        for (int k = 0; k < 8; k++) {
+            g[2 * k] = ssd.ram_buffer[1 + (k << 3) + (PAINEL_TEXTO_Y >> 3)];
+            g[2 * k + 1] = ssd.ram_buffer[1 + (k << 3) + (PAINEL_TEXTO_Y >> 3) + 1];
+        }
+        fprintf(saida, "  {\n");
+        emitir_bytes(g, sizeof(g), "    ");
+        fprintf(saida, "  },\n");
+    }
+    fprintf(saida, "};\n\n");
+
+    // Telas de alerta completas
+    fprintf(saida, "static const uint8_t PAINEL_ALERTA_UM[%d][%d] = {\n", CANAIS_POR_TELA, TELA);
+    for (int c = 0; c < CANAIS_POR_TELA; c++) {
+        painel_alerta_runtime(&ssd, mensagens[c], NULL);
+        fprintf(saida, "  {\n");
+        emitir_bytes(&ssd.ram_buffer[1], TELA, "    ");
+        fprintf(saida, "  },\n");
+    }
+    fprintf(saida, "};\n\n");
+
+    painel_alerta_runtime(&ssd, mensagens[0], mensagens[1]);
+    fprintf(saida, "static const uint8_t PAINEL_ALERTA_DOIS[%d] = {\n", TELA);
+    emitir_bytes(&ssd.ram_buffer[1], TELA, "  ");
+    fprintf(saida, "};\n\n#endif\n");
+
+    if (saida != stdout)
+        fclose(saida);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+/**
+ * Substituto mínimo do FreeRTOS.h para compilar as bibliotecas de lib/ no
+ * host; as filas são implementadas com pthreads em fila_host.c
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms)) // 1 tick = 1 ms, como configTICK_RATE_HZ 1000
+
+#define pvPortMalloc malloc
+#define vPortFree free
+
+#endif
@@ -0,0 +1,116 @@
+#include "queue.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Filas do FreeRTOS no host: buffer circular protegido por mutex, com
+ * variáveis de condição para as esperas com timeout
+ */
+struct Fila_host {
+    pthread_mutex_t mutex;
+    pthread_cond_t tem_item;
+    pthread_cond_t tem_espaco;
+    uint8_t *itens;
+    UBaseType_t tamanho, tamanho_item;
+    UBaseType_t cabeca, n;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t tamanho, UBaseType_t tamanho_item) {
+    QueueHandle_t f = calloc(1, sizeof(*f));
+    if (f == NULL)
+        return NULL;
+    f->itens = malloc(tamanho * tamanho_item);
+    if (f->itens == NULL) {
+        free(f);
+        return NULL;
+    }
+    f->tamanho = tamanho;
+    f->tamanho_item = tamanho_item;
+    pthread_mutex_init(&f->mutex, NULL);
+    pthread_cond_init(&f->tem_item, NULL);
+    pthread_cond_init(&f->tem_espaco, NULL);
+    return f;
+}
+
+// Espera a condição até o prazo; retorna false no timeout
+static int esperar(pthread_cond_t *c, pthread_mutex_t *m, TickType_t espera, const struct timespec *prazo) {
+    if (espera == 0)
+        return 0;
+    if (espera == portMAX_DELAY)
+        return pthread_cond_wait(c, m) == 0;
+    return pthread_cond_timedwait(c, m, prazo) == 0;
+}
+
+static void calcular_prazo(TickType_t espera, struct timespec *prazo) {
+    clock_gettime(CLOCK_REALTIME, prazo);
+    if (espera == portMAX_DELAY)
+        return;
+    prazo->tv_sec += espera / 1000;
+    prazo->tv_nsec += (long)(espera % 1000) * 1000000L;
+    if (prazo->tv_nsec >= 1000000000L) {
+        prazo->tv_sec++;
+        prazo->tv_nsec -= 1000000000L;
+    }
+}
+
+static void inserir(QueueHandle_t f, const void *item) {
+    UBaseType_t pos = (f->cabeca + f->n) % f->tamanho;
+    memcpy(f->itens + pos * f->tamanho_item, item, f->tamanho_item);
+    f->n++;
+    pthread_cond_signal(&f->tem_item);
+}
+
+BaseType_t xQueueSend(QueueHandle_t f, const void *item, TickType_t espera) {
+    struct timespec prazo;
+    calcular_prazo(espera, &prazo);
+    pthread_mutex_lock(&f->mutex);
+    while (f->n == f->tamanho) {
+        if (!esperar(&f->tem_espaco, &f->mutex, espera, &prazo)) {
+            pthread_mutex_unlock(&f->mutex);
+            return pdFALSE;
+        }
+    }
+    inserir(f, item);
+    pthread_mutex_unlock(&f->mutex);
+    return pdTRUE;
+}
+
+/**
+ * Como no FreeRTOS, só faz sentido em filas de 1 posição
+ */
+BaseType_t xQueueOverwrite(QueueHandle_t f, const void *item) {
+    pthread_mutex_lock(&f->mutex);
+    if (f->n == f->tamanho) {
+        f->cabeca = (f->cabeca + 1) % f->tamanho;
+        f->n--;
+    }
+    inserir(f, item);
+    pthread_mutex_unlock(&f->mutex);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t f, void *item, TickType_t espera) {
+    struct timespec prazo;
+    calcular_prazo(espera, &prazo);
+    pthread_mutex_lock(&f->mutex);
+    while (f->n == 0) {
+        if (!esperar(&f->tem_item, &f->mutex, espera, &prazo)) {
+            pthread_mutex_unlock(&f->mutex);
+            return pdFALSE;
+        }
+    }
+    memcpy(item, f->itens + f->cabeca * f->tamanho_item, f->tamanho_item);
+    f->cabeca = (f->cabeca + 1) % f->tamanho;
+    f->n--;
+    pthread_cond_signal(&f->tem_espaco);
+    pthread_mutex_unlock(&f->mutex);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t f) {
+    pthread_mutex_lock(&f->mutex);
+    UBaseType_t n = f->n;
+    pthread_mutex_unlock(&f->mutex);
+    return n;
+}
@@ -0,0 +1,18 @@
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+/**
+ * Substituto mínimo do pico/stdlib.h para compilar as bibliotecas de lib/
+ * no host (ferramentas e benchmarks de tools/)
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(f) f
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef HOST_QUEUE_H
+#define HOST_QUEUE_H
+
+#include "FreeRTOS.h"
+
+typedef struct Fila_host *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t tamanho, UBaseType_t tamanho_item);
+BaseType_t xQueueSend(QueueHandle_t fila, const void *item, TickType_t espera);
+BaseType_t xQueueOverwrite(QueueHandle_t fila, const void *item);
+BaseType_t xQueueReceive(QueueHandle_t fila, void *item, TickType_t espera);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t fila);
+
+#endif
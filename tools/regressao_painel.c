@@ -0,0 +1,503 @@
+/**
+ * Regressão do desenho do display contra quadros de referência
+ *
+ * Renderiza cada primitiva do ssd1306 (incluindo os casos de borda: quebra
+ * de linha do draw_string, corte na última linha, pixel com y além de 63)
+ * e cada tela do vDisplayTask (painel em todas as faixas de estado, telas
+ * de alerta, gráficos de histórico) num ram_buffer e compara byte a byte
+ * com tools/referencia/painel.quadros. As telas são conferidas nas duas
+ * versões (runtime e pré-renderizada) contra o mesmo quadro.
+ *
+ * Depois mede o custo por quadro e por primitiva: ns e, se o kernel
+ * permitir perf_event_open, ciclos e instruções, descontado o preparo do
+ * quadro a cada repetição.
+ *
+ *   make -C tools regressao         confere e mede
+ *   make -C tools referencia        regrava as referências (mudança intencional)
+ *   tools/bin/regressao_painel -d /tmp/quadros ...   grava PBMs das divergências
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "painel.h"
+
+#define QUADRO_BYTES (WIDTH * HEIGHT / 8)
+#define NOME_MAX 32
+#define CASOS_MAX 96
+#define REFERENCIA_MAGICA 0x31465251u // "QRF1"
+#define SUJEIRA 0xA5                  // Telas devem sobrescrever o quadro inteiro
+#define MEDICAO_NS 20000000           // Tempo de medição de cada caso
+
+typedef struct {
+    char nome[NOME_MAX];
+    uint8_t quadro[QUADRO_BYTES];
+} Referencia;
+
+typedef void (*Desenho)(ssd1306_t *ssd, const void *arg);
+
+typedef struct {
+    const char *nome;
+    Desenho desenho;
+    Desenho alternativo;   // Outra versão que deve gerar o mesmo quadro (ou NULL)
+    const void *arg;
+    bool sujo;             // Começa de um quadro sujo em vez de apagado
+} Caso;
+
+static Caso casos[CASOS_MAX];
+static int n_casos;
+static Tabela_canais tabela;
+static Historico historico;
+
+// ================= CASOS =================
+
+static void adicionar(const char *nome, Desenho desenho, Desenho alternativo, const void *arg, bool sujo) {
+    if (n_casos < CASOS_MAX)
+        casos[n_casos++] = (Caso){nome, desenho, alternativo, arg, sujo};
+}
+
+static void p_fill_apagado(ssd1306_t *s, const void *a) { ssd1306_fill(s, false); }
+static void p_fill_aceso(ssd1306_t *s, const void *a) { ssd1306_fill(s, true); }
+static void p_rect_contorno(ssd1306_t *s, const void *a) { ssd1306_rect(s, 5, 7, 50, 20, true, false); }
+static void p_rect_cheio(ssd1306_t *s, const void *a) { ssd1306_rect(s, 13, 30, 61, 37, true, true); }
+static void p_rect_canto(ssd1306_t *s, const void *a) { ssd1306_rect(s, 56, 120, 8, 8, true, true); }
+static void p_rect_apaga(ssd1306_t *s, const void *a) {
+    ssd1306_fill(s, true);
+    ssd1306_rect(s, 3, 3, 100, 50, false, true);
+}
+static void p_linhas(ssd1306_t *s, const void *a) {
+    ssd1306_line(s, 0, 0, 127, 63, true);
+    ssd1306_line(s, 127, 0, 0, 63, true);   // Sentido invertido
+    ssd1306_line(s, 10, 60, 14, 2, true);   // Íngreme
+    ssd1306_line(s, 64, 32, 64, 32, true);  // Ponto
+}
+static void p_hline_vline(ssd1306_t *s, const void *a) {
+    ssd1306_hline(s, 0, 127, 7, true);
+    ssd1306_hline(s, 20, 90, 8, true);
+    ssd1306_vline(s, 0, 0, 63, true);
+    ssd1306_vline(s, 127, 9, 40, true);
+}
+static void p_caracteres(ssd1306_t *s, const void *a) {
+    // Toda a faixa imprimível, mais um caractere fora dela (vira o glifo 0)
+    for (int c = ' '; c <= '~'; c++)
+        ssd1306_draw_char(s, (char)c, (uint8_t)((c - ' ') % 16 * 8), (uint8_t)((c - ' ') / 16 * 8));
+    ssd1306_draw_char(s, '\n', 120, 56);
+}
+static void p_caractere_fora_de_pagina(ssd1306_t *s, const void *a) {
+    ssd1306_draw_char(s, 'A', 3, 5);        // Cruza duas páginas
+    ssd1306_draw_char(s, 'g', 60, 29);
+}
+static void p_texto(ssd1306_t *s, const void *a) { ssd1306_draw_string(s, "CHUVA 42%", 0, 0); }
+static void p_texto_quebra(ssd1306_t *s, const void *a) {
+    // Quebra quando o próximo caractere passaria de x + 8 >= 128
+    ssd1306_draw_string(s, "RIO TRANSBORDANDO AGORA", 100, 10);
+}
+static void p_texto_fim_da_tela(ssd1306_t *s, const void *a) {
+    // Para antes de uma linha que não cabe (y + 8 >= 64)
+    ssd1306_draw_string(s, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 0, 40);
+}
+static void p_pixel_alem_de_63(ssd1306_t *s, const void *a) {
+    // y de 64 a 71 cai na página 0 da coluna seguinte (endereçamento vertical)
+    for (uint8_t y = 60; y < 72; y++)
+        ssd1306_pixel(s, 10, y, true);
+    ssd1306_pixel(s, 50, 70, true);
+    ssd1306_pixel(s, 50, 64, true);
+    ssd1306_pixel(s, 51, 6, false);   // Apaga um dos que caíram na coluna 51
+}
+
+// Telas: painel com os valores e o primeiro canal dados
+typedef struct {
+    uint16_t valor[4];
+    uint8_t n;
+    uint8_t primeiro;
+} Painel;
+
+static void preencher(Dados_analogicos *d, const Painel *p) {
+    memset(d, 0, sizeof(*d));
+    d->n = p->n;
+    memcpy(d->valor, p->valor, sizeof(p->valor));
+    canais_classificar(&tabela, d->valor, d->estado);
+    d->estado_global = canais_estado_global(d->estado, d->n);
+}
+static void t_painel(ssd1306_t *s, const void *a) {
+    Dados_analogicos d;
+    preencher(&d, a);
+    painel_dashboard(s, &tabela, &d, ((const Painel *)a)->primeiro);
+}
+static void t_painel_runtime(ssd1306_t *s, const void *a) {
+    Dados_analogicos d;
+    preencher(&d, a);
+    painel_dashboard_runtime(s, &tabela, &d, ((const Painel *)a)->primeiro);
+}
+
+static void t_alerta(ssd1306_t *s, const void *a) {
+    const char *const *l = a;
+    painel_alerta(s, l[0], l[1]);
+}
+static void t_alerta_runtime(ssd1306_t *s, const void *a) {
+    const char *const *l = a;
+    painel_alerta_runtime(s, l[0], l[1]);
+}
+
+typedef struct {
+    const Historico *h;
+    uint8_t nivel;
+    uint8_t canal;
+} Grafico;
+
+static void t_grafico(ssd1306_t *s, const void *a) {
+    const Grafico *g = a;
+    painel_grafico(s, &tabela, g->h, g->nivel, g->canal);
+}
+static void t_grafico_runtime(ssd1306_t *s, const void *a) {
+    const Grafico *g = a;
+    painel_grafico_runtime(s, &tabela, g->h, g->nivel, g->canal);
+}
+
+/**
+ * Histórico sintético: 21 h a 10 Hz com ondas, ruído e um buraco sem amostras
+ */
+static void gerar_historico(Historico *h) {
+    uint32_t semente = 1;
+    historico_init(h, 2);
+    for (uint32_t k = 0; k < 21u * 3600 * 10; k++) {
+        if (k / 10 % 5000 > 4900)
+            continue;
+        uint16_t v[2];
+        semente = semente * 1103515245 + 12345;
+        int32_t onda = (int32_t)(k / 10 % 2000);
+        v[0] = (uint16_t)((onda < 1000 ? onda : 2000 - onda) * 9 / 10 + (semente >> 16) % 100);
+        v[1] = (uint16_t)(k / 10 % 1000);
+        historico_amostra(h, k * 100000u, v);
+    }
+}
+
+static void cadastrar_casos(void) {
+    // Valores nas faixas normal / atenção / alerta dos limiares cadastrados e nas bordas
+    static const Painel paineis[] = {
+        {{0, 0}, 2, 0}, {{399, 0}, 2, 0}, {{400, 400}, 2, 0}, {{799, 699}, 2, 0},
+        {{800, 700}, 2, 0}, {{1000, 1000}, 2, 0}, {{57, 943}, 2, 0}, {{994, 5}, 2, 0},
+        {{300, 0}, 1, 0}, {{420, 760, 880, 15}, 4, 2}, {{420, 760, 880, 0}, 3, 2}
+    };
+    static char nomes_painel[sizeof(paineis) / sizeof(paineis[0])][NOME_MAX];
+    static const char *const alertas[][2] = {
+        {"CHUVA INTENSA", NULL}, {"NIVEL ELEVADO", NULL}, {"CHUVA INTENSA", "NIVEL ELEVADO"},
+        {"RIO TRANSBORDANDO", NULL}, {"RIO 2 ELEVADO", "PRESSAO"}
+    };
+    static char nomes_alerta[sizeof(alertas) / sizeof(alertas[0])][NOME_MAX];
+    static Historico vazio;
+    static Grafico graficos[HIST_NIVEIS * 2 + 1];
+    static char nomes_grafico[HIST_NIVEIS * 2 + 1][NOME_MAX];
+
+    adicionar("fill_apagado", p_fill_apagado, NULL, NULL, true);
+    adicionar("fill_aceso", p_fill_aceso, NULL, NULL, true);
+    adicionar("rect_contorno", p_rect_contorno, NULL, NULL, false);
+    adicionar("rect_cheio", p_rect_cheio, NULL, NULL, false);
+    adicionar("rect_canto", p_rect_canto, NULL, NULL, false);
+    adicionar("rect_apaga", p_rect_apaga, NULL, NULL, false);
+    adicionar("linhas", p_linhas, NULL, NULL, false);
+    adicionar("hline_vline", p_hline_vline, NULL, NULL, false);
+    adicionar("caracteres", p_caracteres, NULL, NULL, false);
+    adicionar("caractere_entre_paginas", p_caractere_fora_de_pagina, NULL, NULL, false);
+    adicionar("texto", p_texto, NULL, NULL, false);
+    adicionar("texto_quebra", p_texto_quebra, NULL, NULL, false);
+    adicionar("texto_fim_da_tela", p_texto_fim_da_tela, NULL, NULL, false);
+    adicionar("pixel_alem_de_63", p_pixel_alem_de_63, NULL, NULL, false);
+
+    for (size_t k = 0; k < sizeof(paineis) / sizeof(paineis[0]); k++) {
+        const Painel *p = &paineis[k];
+        snprintf(nomes_painel[k], NOME_MAX, "painel_%u_%u_%u", p->valor[p->primeiro],
+                 p->primeiro + 1 < p->n ? p->valor[p->primeiro + 1] : 0, p->primeiro);
+        adicionar(nomes_painel[k], t_painel, t_painel_runtime, p, true);
+    }
+    for (size_t k = 0; k < sizeof(alertas) / sizeof(alertas[0]); k++) {
+        snprintf(nomes_alerta[k], NOME_MAX, "alerta_%zu", k);
+        adicionar(nomes_alerta[k], t_alerta, t_alerta_runtime, alertas[k], true);
+    }
+
+    gerar_historico(&historico);
+    historico_init(&vazio, 2);
+    int g = 0;
+    for (uint8_t nivel = 0; nivel < HIST_NIVEIS; nivel++) {
+        for (uint8_t canal = 0; canal < 2; canal++, g++) {
+            graficos[g] = (Grafico){&historico, nivel, canal};
+            snprintf(nomes_grafico[g], NOME_MAX, "grafico_n%u_c%u", nivel, canal);
+            adicionar(nomes_grafico[g], t_grafico, t_grafico_runtime, &graficos[g], true);
+        }
+    }
+    graficos[g] = (Grafico){&vazio, 1, 0};
+    snprintf(nomes_grafico[g], NOME_MAX, "grafico_vazio");
+    adicionar(nomes_grafico[g], t_grafico, t_grafico_runtime, &graficos[g], true);
+}
+
+// ================= CONFERÊNCIA =================
+
+static void renderizar(ssd1306_t *s, const Caso *c, Desenho desenho) {
+    memset(s->ram_buffer + 1, c->sujo ? SUJEIRA : 0x00, s->bufsize - 1);
+    desenho(s, c->arg);
+}
+
+/**
+ * Quadro em PBM (P4) para inspeção; o ram_buffer é coluna a coluna, 8
+ * linhas por byte
+ */
+static void gravar_pbm(const char *pasta, const char *nome, const char *sufixo, const uint8_t *quadro) {
+    char caminho[512];
+    snprintf(caminho, sizeof(caminho), "%s/%s%s.pbm", pasta, nome, sufixo);
+    FILE *f = fopen(caminho, "wb");
+    if (f == NULL)
+        return;
+    fprintf(f, "P4\n%d %d\n", WIDTH, HEIGHT);
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x += 8) {
+            uint8_t b = 0;
+            for (int k = 0; k < 8; k++)
+                b |= (uint8_t)(((quadro[(x + k) * (HEIGHT / 8) + y / 8] >> (y & 7)) & 1) << (7 - k));
+            fputc(b, f);
+        }
+    }
+    fclose(f);
+}
+
+static int ler_referencias(const char *caminho, Referencia **refs) {
+    FILE *f = fopen(caminho, "rb");
+    uint32_t cabecalho[2];
+    if (f == NULL || fread(cabecalho, sizeof(cabecalho), 1, f) != 1 || cabecalho[0] != REFERENCIA_MAGICA) {
+        if (f != NULL)
+            fclose(f);
+        return -1;
+    }
+    *refs = calloc(cabecalho[1], sizeof(Referencia));
+    int n = (int)fread(*refs, sizeof(Referencia), cabecalho[1], f);
+    fclose(f);
+    return n;
+}
+
+static int gravar_referencias(const char *caminho, ssd1306_t *s) {
+    FILE *f = fopen(caminho, "wb");
+    if (f == NULL) {
+        perror(caminho);
+        return 1;
+    }
+    uint32_t cabecalho[2] = {REFERENCIA_MAGICA, (uint32_t)n_casos};
+    fwrite(cabecalho, sizeof(cabecalho), 1, f);
+    for (int k = 0; k < n_casos; k++) {
+        Referencia r;
+        memset(&r, 0, sizeof(r));
+        strncpy(r.nome, casos[k].nome, NOME_MAX - 1);
+        renderizar(s, &casos[k], casos[k].desenho);
+        memcpy(r.quadro, s->ram_buffer + 1, QUADRO_BYTES);
+        fwrite(&r, sizeof(r), 1, f);
+    }
+    fclose(f);
+    printf("%d quadros de referência gravados em %s\n", n_casos, caminho);
+    return 0;
+}
+
+/**
+ * Compara uma versão do caso com a referência; retorna os bytes diferentes
+ */
+static int comparar(ssd1306_t *s, const Caso *c, Desenho desenho, const Referencia *r, const char *pasta,
+                    const char *versao) {
+    renderizar(s, c, desenho);
+    const uint8_t *q = s->ram_buffer + 1;
+    int diferentes = 0, primeiro = -1;
+    for (int i = 0; i < QUADRO_BYTES; i++) {
+        if (q[i] != r->quadro[i]) {
+            diferentes++;
+            if (primeiro < 0)
+                primeiro = i;
+        }
+    }
+    if (diferentes > 0) {
+        printf("FALHOU %-26s %-8s %4d bytes diferentes, primeiro em x=%d pagina=%d\n", c->nome, versao,
+               diferentes, primeiro / (HEIGHT / 8), primeiro % (HEIGHT / 8));
+        if (pasta != NULL) {
+            gravar_pbm(pasta, c->nome, "_obtido", q);
+            gravar_pbm(pasta, c->nome, "_esperado", r->quadro);
+        }
+    }
+    return diferentes;
+}
+
+// ================= MEDIÇÃO =================
+
+static int contadores = -1;   // Líder do grupo (ciclos) ou -1 sem perf
+
+static int abrir_contador(uint64_t config, int grupo) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = grupo < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, grupo, 0);
+}
+
+static void iniciar_contadores(void) {
+    contadores = abrir_contador(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (contadores >= 0 && abrir_contador(PERF_COUNT_HW_INSTRUCTIONS, contadores) < 0) {
+        close(contadores);
+        contadores = -1;
+    }
+}
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef struct {
+    double ns;
+    double ciclos;
+    double instrucoes;
+} Custo;
+
+typedef struct {
+    uint64_t n;
+    uint64_t ciclos;
+    uint64_t instrucoes;
+} Leitura_perf;
+
+/**
+ * Tempo e contadores de repeticoes chamadas; sem desenho, só o preparo do quadro
+ */
+static Custo executar(ssd1306_t *s, const Caso *c, Desenho desenho, long repeticoes) {
+    Leitura_perf leitura = {0};
+    Custo custo = {0};
+
+    if (contadores >= 0) {
+        ioctl(contadores, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(contadores, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    double t0 = agora_ns();
+    for (long r = 0; r < repeticoes; r++) {
+        memset(s->ram_buffer + 1, c->sujo ? SUJEIRA : 0x00, s->bufsize - 1);
+        if (desenho != NULL)
+            desenho(s, c->arg);
+    }
+    custo.ns = agora_ns() - t0;
+    if (contadores >= 0) {
+        ioctl(contadores, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        if (read(contadores, &leitura, sizeof(leitura)) == sizeof(leitura)) {
+            custo.ciclos = (double)leitura.ciclos;
+            custo.instrucoes = (double)leitura.instrucoes;
+        }
+    }
+    return custo;
+}
+
+/**
+ * Custo médio de uma chamada: blocos de repetições de ~MEDICAO_NS, menos
+ * o custo de preparar o quadro a cada repetição
+ */
+static Custo medir(ssd1306_t *s, const Caso *c, Desenho desenho) {
+    long repeticoes = 1;
+    while (executar(s, c, desenho, repeticoes).ns < MEDICAO_NS / 10)
+        repeticoes *= 2;
+    repeticoes *= 10;
+
+    Custo total = executar(s, c, desenho, repeticoes);
+    Custo preparo = executar(s, c, NULL, repeticoes);
+    return (Custo){
+        (total.ns - preparo.ns) / repeticoes,
+        (total.ciclos - preparo.ciclos) / repeticoes,
+        (total.instrucoes - preparo.instrucoes) / repeticoes
+    };
+}
+
+static void imprimir_custo(const char *nome, const char *versao, Custo c) {
+    if (contadores >= 0)
+        printf("%-26s %-8s %10.0f %12.0f %12.0f %6.2f\n", nome, versao, c.ns, c.ciclos, c.instrucoes,
+               c.ciclos > 0 ? c.instrucoes / c.ciclos : 0.0);
+    else
+        printf("%-26s %-8s %10.0f %12s %12s %6s\n", nome, versao, c.ns, "-", "-", "-");
+}
+
+static int uso(const char *nome) {
+    fprintf(stderr, "uso: %s [-g] [-d pasta_pbm] [-m] <referencias>\n"
+                    "  -g  grava as referências com o código atual\n"
+                    "  -d  grava obtido/esperado em PBM para cada divergência\n"
+                    "  -m  só confere, sem medir\n", nome);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    bool gravar = false, medicao = true;
+    const char *pasta = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "gd:m")) != -1) {
+        switch (opt) {
+            case 'g': gravar = true; break;
+            case 'd': pasta = optarg; break;
+            case 'm': medicao = false; break;
+            default: return uso(argv[0]);
+        }
+    }
+    if (optind != argc - 1)
+        return uso(argv[0]);
+    const char *caminho = argv[optind];
+
+    canais_init(&tabela);
+    canais_adicionar(&tabela, "CHUVA", "CHUVA INTENSA", FONTE_ADC, 1, 0, 4088, 400, 800);
+    canais_adicionar(&tabela, "NIVEL", "NIVEL ELEVADO", FONTE_ADC, 0, 0, 4088, 400, 700);
+    canais_adicionar(&tabela, "RIO 2", "RIO 2 ELEVADO", FONTE_ADC, 2, 0, 4088, 400, 700);
+    canais_adicionar(&tabela, "PRESS", "NIVEL ELEVADO", FONTE_EXTERNA, 1, 1638, 14745, 400, 700);
+    cadastrar_casos();
+
+    ssd1306_t ssd;
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+    if (gravar)
+        return gravar_referencias(caminho, &ssd);
+
+    Referencia *refs = NULL;
+    int n_refs = ler_referencias(caminho, &refs);
+    if (n_refs < 0) {
+        fprintf(stderr, "%s: referências ausentes ou inválidas (gere com -g)\n", caminho);
+        return 1;
+    }
+
+    int falhas = 0;
+    for (int k = 0; k < n_casos; k++) {
+        const Caso *c = &casos[k];
+        const Referencia *r = NULL;
+        for (int i = 0; i < n_refs && r == NULL; i++) {
+            if (strncmp(refs[i].nome, c->nome, NOME_MAX) == 0)
+                r = &refs[i];
+        }
+        if (r == NULL) {
+            printf("FALHOU %-26s sem quadro de referência\n", c->nome);
+            falhas++;
+            continue;
+        }
+        bool falhou = comparar(&ssd, c, c->desenho, r, pasta, c->alternativo ? "assets" : "") > 0;
+        if (c->alternativo != NULL)
+            falhou |= comparar(&ssd, c, c->alternativo, r, pasta, "runtime") > 0;
+        falhas += falhou;
+    }
+    printf("conferência: %d casos, %s (%d falhas)\n", n_casos, falhas ? "FALHOU" : "ok", falhas);
+
+    if (medicao) {
+        iniciar_contadores();
+        printf("\n%-26s %-8s %10s %12s %12s %6s\n", "caso", "versao", "ns", "ciclos", "instrucoes", "ipc");
+        for (int k = 0; k < n_casos; k++) {
+            const Caso *c = &casos[k];
+            imprimir_custo(c->nome, c->alternativo ? "assets" : "", medir(&ssd, c, c->desenho));
+            if (c->alternativo != NULL)
+                imprimir_custo(c->nome, "runtime", medir(&ssd, c, c->alternativo));
+        }
+        if (contadores < 0)
+            printf("(sem perf_event_open: ciclos e instruções indisponíveis; veja kernel.perf_event_paranoid)\n");
+    }
+    free(refs);
+    return falhas != 0;
+}
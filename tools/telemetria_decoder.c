@@ -0,0 +1,319 @@
+/**
+ * Decodificador de host da telemetria USB da estação
+ *
+ * Lê o fluxo COBS de uma porta serial (ex.: /dev/ttyACM0), de um arquivo
+ * ou da entrada padrão ("-"), valida CRC e sequência e mostra a vazão a
+ * cada segundo. Com -g N gera N quadros sintéticos na saída padrão, para
+ * medir a vazão do decodificador sem a placa:
+ *
+ *   tools/bin/telemetria_decoder -g 1000000 | tools/bin/telemetria_decoder -
+ *   tools/bin/telemetria_decoder -v /dev/ttyACM0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <time.h>
+#include "telemetria.h"
+#include "perfil_xip.h"
+#include "relogio.h"
+
+typedef struct {
+    uint64_t quadros, bytes, erros_crc, erros_cobs, perdidos;
+    uint64_t por_tipo[16];
+    uint32_t descartados_placa;
+    int seq_anterior;
+} Estatisticas;
+
+static double agora_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint16_t ler_u16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+static uint32_t ler_u32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+// Carga mínima de cada tipo (sem cabeçalho nem CRC), conforme lib/telemetria.h
+static const uint8_t carga_minima[16] = {
+    [TELEM_AMOSTRA] = 2,     [TELEM_EVENTO] = 5,      [TELEM_CONTADORES] = 16, [TELEM_DISPLAY] = 16,
+    [TELEM_BOOT] = 12,       [TELEM_ESTRESSE] = 20,   [TELEM_I2C] = 28,        [TELEM_CONFIG] = 16,
+    [TELEM_SAUDE] = 24,      [TELEM_HISTOGRAMA] = 2,  [TELEM_PILHA] = 4,       [TELEM_FALHA] = 4,
+    [TELEM_XIP] = 20,        [TELEM_RELOGIO] = 32
+};
+
+static void mostrar(const uint8_t *r, size_t n) {
+    uint32_t t = ler_u32(&r[3]);
+    if (r[0] < 16 && n < TELEM_CABECALHO + (size_t)carga_minima[r[0]]) {
+        printf("%10u tipo %u curto: %zu bytes de carga, minimo %u\n",
+               t, r[0], n - TELEM_CABECALHO, carga_minima[r[0]]);
+        return;
+    }
+    switch (r[0]) {
+        case TELEM_AMOSTRA:
+            printf("%10u AMOSTRA global=%u", t, r[8]);
+            for (uint8_t i = 0; i < r[7] && (size_t)(11 + 3 * i) < n; i++)
+                printf("  c%u=%u.%u%%/%u", i, ler_u16(&r[9 + 3 * i]) / 10, ler_u16(&r[9 + 3 * i]) % 10, r[11 + 3 * i]);
+            printf("\n");
+            break;
+        case TELEM_EVENTO:
+            printf("%10u EVENTO canal=%u %u -> %u valor=%u\n", t, r[7], r[8], r[9], ler_u16(&r[10]));
+            break;
+        case TELEM_CONTADORES:
+            printf("%10u CONTADORES publicados=%u descartados=%u enviados=%u bytes=%u\n",
+                   t, ler_u32(&r[7]), ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]));
+            break;
+        case TELEM_BOOT: {
+            static const char *const fases[] = {
+                "main", "hw_alerta", "agendador", "primeira_amostra", "primeiro_alerta",
+                "matriz", "display", "primeiro_quadro", "usb"
+            };
+            uint32_t f = ler_u32(&r[7]);
+            // Firmware antigo não tem o campo alterado
+            bool alterado = n >= TELEM_CABECALHO + 16 && ler_u32(&r[19]);
+            printf("%10u BOOT build=%08x%s %-16s %8.3f ms\n", t, ler_u32(&r[15]), alterado ? "+alt" : "",
+                   f < sizeof(fases) / sizeof(fases[0]) ? fases[f] : "?", ler_u32(&r[11]) / 1000.0);
+            break;
+        }
+        case TELEM_DISPLAY:
+            printf("%10u DISPLAY quadros=%u perdidos=%u tempo=%uus max=%uus\n",
+                   t, ler_u32(&r[7]), ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]));
+            break;
+        case TELEM_ESTRESSE:
+            printf("%10u ESTRESSE taxa=%uHz amostras=%u perdas=%u maior_ok=%uHz",
+                   t, ler_u32(&r[7]), ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]));
+            // Anel cheio pela USB: fora das perdas da busca (firmware antigo não envia)
+            if (n >= TELEM_CABECALHO + 24)
+                printf(" telemetria_descartada=%u", ler_u32(&r[27]));
+            printf("%s\n", ler_u32(&r[23]) ? " (concluida)" : "");
+            break;
+        case TELEM_I2C: {
+            // Uso do barramento: tempo ocupado desde o relatório anterior do cliente
+            static uint32_t t_anterior[8], ocupado_anterior[8];
+            uint32_t c = ler_u32(&r[7]) & 7, ocupado = ler_u32(&r[23]);
+            double uso = t_anterior[c] && t != t_anterior[c]
+                       ? 100.0 * (ocupado - ocupado_anterior[c]) / (t - t_anterior[c]) : 0;
+            t_anterior[c] = t;
+            ocupado_anterior[c] = ocupado;
+            printf("%10u I2C cliente=%u transacoes=%u bytes=%u erros=%u uso=%.1f%% espera_max=%uus recuperacoes=%u\n",
+                   t, c, ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]), uso, ler_u32(&r[27]), ler_u32(&r[31]));
+            break;
+        }
+        case TELEM_SAUDE:
+            printf("%10u SAUDE tarefa=%u ativacoes=%u perdas=%u atraso_max=%uus execucao_max=%uus ultimo_estouro=%uus\n",
+                   t, ler_u32(&r[7]), ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]), ler_u32(&r[23]), ler_u32(&r[27]));
+            break;
+        case TELEM_HISTOGRAMA: {
+            // Contagens acumuladas módulo 2^16: mostra o que chegou desde o relatório anterior
+            static uint16_t anterior[8][2][16];
+            uint8_t tarefa = r[7] & 7, tipo = r[8] & 1;
+            printf("%10u HISTOGRAMA tarefa=%u %-8s", t, tarefa, tipo ? "execucao" : "atraso");
+            for (uint8_t k = 0; k < 16 && (size_t)(10 + 2 * k) < n; k++) {
+                uint16_t c = ler_u16(&r[9 + 2 * k]);
+                uint16_t d = (uint16_t)(c - anterior[tarefa][tipo][k]);
+                anterior[tarefa][tipo][k] = c;
+                if (d && k == 15)
+                    printf(" >=%uus:%u", 4u << 14, d);
+                else if (d)
+                    printf(" <%uus:%u", 4u << k, d);
+            }
+            printf("\n");
+            break;
+        }
+        case TELEM_PILHA:
+        case TELEM_FALHA: {
+            static const char *const falhas[] = {"?", "estouro de pilha", "heap esgotado"};
+            uint32_t v = ler_u32(&r[7]);
+            int tam = n > 11 ? (int)(n - 11) : 0;
+            if (r[0] == TELEM_PILHA)
+                printf("%10u PILHA %.*s livre=%u bytes\n", t, tam, (const char *)&r[11], v);
+            else
+                printf("%10u FALHA no ultimo reset: %s em %.*s\n", t, v < 3 ? falhas[v] : "?", tam, (const char *)&r[11]);
+            break;
+        }
+        case TELEM_XIP: {
+            uint32_t e = ler_u32(&r[7]), chamadas = ler_u32(&r[11]);
+            uint32_t acessos = ler_u32(&r[15]), acertos = ler_u32(&r[19]);
+            printf("%10u XIP %-10s chamadas=%u acessos=%u faltas=%u (%.1f%% acertos) faltas/chamada=%.1f tempo/chamada=%.1fus\n",
+                   t, e < XIP_ESTAGIOS ? perfil_xip_nomes[e] : "?", chamadas, acessos,
+                   acessos - acertos, acessos ? 100.0 * acertos / acessos : 100.0,
+                   chamadas ? (double)(acessos - acertos) / chamadas : 0.0,
+                   chamadas ? (double)ler_u32(&r[23]) / chamadas : 0.0);
+            break;
+        }
+        case TELEM_RELOGIO: {
+            // Tempo medido em cada nível; a energia não é medida, sai do modelo de lib/relogio.h
+            static const char *const niveis[] = {"normal", "atencao", "alerta"};
+            static const uint32_t khz[] = {RELOGIO_NORMAL_KHZ, RELOGIO_ATENCAO_KHZ, RELOGIO_ALERTA_KHZ};
+            printf("%10u RELOGIO %uMHz trocas=%u ultima=%uus max=%uus pll_max=%uus", t, ler_u32(&r[7]) / 1000,
+                   ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]), ler_u32(&r[23]));
+            for (int k = 0; k < RELOGIO_NIVEIS; k++)
+                printf(" %s=%.1fs", niveis[k], ler_u32(&r[27 + 4 * k]) / 1000.0);
+            printf(" energia_estimada:");
+            for (int k = 0; k < RELOGIO_NIVEIS; k++)
+                printf(" %s~%umJ", niveis[k], relogio_energia_mj(khz[k], ler_u32(&r[27 + 4 * k])));
+            printf("\n");
+            break;
+        }
+        case TELEM_CONFIG: {
+            static const char *const resultados[] = {"ok", "formato", "faixa", "ocupada", "crc"};
+            uint32_t res = ler_u32(&r[7]);
+            printf("%10u CONFIG %s versao=%u amostragem=%uHz gravada=%u\n", t,
+                   res < sizeof(resultados) / sizeof(resultados[0]) ? resultados[res] : "?",
+                   ler_u32(&r[11]), ler_u32(&r[15]), ler_u32(&r[19]));
+            break;
+        }
+    }
+}
+
+static void processar(Estatisticas *e, const uint8_t *bloco, size_t n, int verboso) {
+    uint8_t r[TELEM_QUADRO_MAX];
+
+    if (n == 0)
+        return;
+    if (n > TELEM_QUADRO_MAX) {
+        e->erros_cobs++;
+        return;
+    }
+    size_t m = cobs_decodificar(bloco, n, r);
+    if (m < TELEM_CABECALHO + 2) {
+        e->erros_cobs++;
+        return;
+    }
+    if (telemetria_crc16(r, m - 2) != ler_u16(&r[m - 2])) {
+        e->erros_crc++;
+        return;
+    }
+
+    int seq = ler_u16(&r[1]);
+    if (e->seq_anterior >= 0)
+        e->perdidos += (uint16_t)(seq - e->seq_anterior - 1);
+    e->seq_anterior = seq;
+
+    e->quadros++;
+    e->bytes += n + 1;
+    if (r[0] < 16)
+        e->por_tipo[r[0]]++;
+    if (r[0] == TELEM_CONTADORES)
+        e->descartados_placa = ler_u32(&r[11]);
+    if (verboso)
+        mostrar(r, m - 2);
+}
+
+static void relatorio(const Estatisticas *e, double segundos, const char *rotulo) {
+    fprintf(stderr, "%s %.0f quadros/s %.1f kB/s | quadros=%llu amostras=%llu eventos=%llu "
+            "crc=%llu cobs=%llu perdidos=%llu descartados(placa)=%u\n",
+            rotulo, e->quadros / segundos, e->bytes / segundos / 1000.0,
+            (unsigned long long)e->quadros, (unsigned long long)e->por_tipo[TELEM_AMOSTRA],
+            (unsigned long long)e->por_tipo[TELEM_EVENTO], (unsigned long long)e->erros_crc,
+            (unsigned long long)e->erros_cobs, (unsigned long long)e->perdidos, e->descartados_placa);
+}
+
+/**
+ * Gera quadros sintéticos com o mesmo código de enquadramento da placa
+ */
+static int gerar(long total) {
+    static Anel_telemetria anel;
+    Registro_telemetria reg;
+    Dados_analogicos d = {0};
+    uint8_t quadro[TELEM_QUADRO_MAX];
+    static uint8_t saida[1 << 16];
+    size_t usado = 0;
+    uint16_t seq = 0;
+
+    telemetria_init(&anel);
+    d.n = 2;
+    for (long k = 0; k < total; k++) {
+        d.instante_us = (uint32_t)(k * 100000);
+        d.valor[0] = (uint16_t)(k % 1001);
+        d.valor[1] = (uint16_t)((k * 7) % 1001);
+        d.estado[0] = d.valor[0] > 800 ? ESTADO_ALERTA : d.valor[0] > 400;
+        d.estado[1] = d.valor[1] > 700 ? ESTADO_ALERTA : d.valor[1] > 400;
+        d.estado_global = canais_estado_global(d.estado, d.n);
+        telemetria_publicar_amostra(&anel, &d);
+
+        while (telemetria_retirar(&anel, &reg)) {
+            size_t n = telemetria_quadro(reg.dados, reg.tamanho, seq++, quadro);
+            if (usado + n > sizeof(saida)) {
+                if (fwrite(saida, 1, usado, stdout) != usado)
+                    return 1;
+                usado = 0;
+            }
+            memcpy(&saida[usado], quadro, n);
+            usado += n;
+        }
+    }
+    return fwrite(saida, 1, usado, stdout) != usado;
+}
+
+static void configurar_serial(int fd) {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) != 0)
+        return; // Arquivo ou pipe
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+int main(int argc, char **argv) {
+    int verboso = 0;
+    const char *caminho = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0)
+            verboso = 1;
+        else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc)
+            return gerar(atol(argv[++i]));
+        else
+            caminho = argv[i];
+    }
+    if (caminho == NULL) {
+        fprintf(stderr, "uso: %s [-v] <porta|arquivo|->  |  %s -g <quadros>\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    int fd = strcmp(caminho, "-") == 0 ? STDIN_FILENO : open(caminho, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+        perror(caminho);
+        return 1;
+    }
+    configurar_serial(fd);
+
+    Estatisticas e = {0};
+    e.seq_anterior = -1;
+    uint8_t entrada[4096], bloco[TELEM_QUADRO_MAX + 1];
+    size_t n_bloco = 0;
+    double inicio = agora_s(), ultimo = inicio;
+    Estatisticas janela = e;
+
+    ssize_t lidos;
+    while ((lidos = read(fd, entrada, sizeof(entrada))) > 0) {
+        for (ssize_t i = 0; i < lidos; i++) {
+            if (entrada[i] == 0) {
+                processar(&e, bloco, n_bloco, verboso);
+                n_bloco = 0;
+            } else if (n_bloco < sizeof(bloco)) {
+                bloco[n_bloco++] = entrada[i];
+            } else {
+                n_bloco = sizeof(bloco) + 1; // Descarta até o próximo delimitador
+            }
+        }
+
+        double t = agora_s();
+        if (t - ultimo >= 1.0) {
+            Estatisticas delta = e;
+            delta.quadros -= janela.quadros;
+            delta.bytes -= janela.bytes;
+            relatorio(&delta, t - ultimo, "[1s]");
+            janela = e;
+            ultimo = t;
+        }
+    }
+
+    relatorio(&e, agora_s() - inicio, "[total]");
+    return 0;
+}